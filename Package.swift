@@ -1,10 +1,11 @@
-// swift-tools-version:5.3
+// swift-tools-version:5.5
 import PackageDescription
 
 let package = Package(
     name: "TreeSitterRad",
     products: [
         .library(name: "TreeSitterRad", targets: ["TreeSitterRad"]),
+        .library(name: "TreeSitterRadBatch", targets: ["TreeSitterRadBatch"]),
     ],
     dependencies: [
         .package(url: "https://github.com/ChimeHQ/SwiftTreeSitter", from: "0.8.0"),
@@ -16,19 +17,25 @@ let package = Package(
             path: ".",
             sources: [
                 "src/parser.c",
-                // NOTE: if your language has an external scanner, add it here.
-            ],
-            resources: [
-                .copy("queries")
+                "src/scanner.c",
             ],
             publicHeadersPath: "bindings/swift",
             cSettings: [.headerSearchPath("src")]
         ),
+        .target(
+            name: "TreeSitterRadBatch",
+            dependencies: [
+                "SwiftTreeSitter",
+                "TreeSitterRad",
+            ],
+            path: "bindings/swift/TreeSitterRadBatch"
+        ),
         .testTarget(
             name: "TreeSitterRadTests",
             dependencies: [
                 "SwiftTreeSitter",
                 "TreeSitterRad",
+                "TreeSitterRadBatch",
             ],
             path: "bindings/swift/TreeSitterRadTests"
         )
@@ -0,0 +1,152 @@
+#ifndef TREE_SITTER_RAD_BENCH_H_
+#define TREE_SITTER_RAD_BENCH_H_
+
+// Shared helpers for the C benchmarks. Each benchmark prints one JSON object
+// per measurement on stdout so runs can be diffed or loaded as JSON lines.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "tree-sitter-rad.h"
+#include <tree_sitter/api.h>
+
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+// Each measurement repeats until it has run at least this long, so small
+// inputs are measured well above clock resolution.
+#define BENCH_MIN_RUN_NS 200000000ull
+
+// Calls `run(payload)` until `min_ns` have passed. Returns the mean time per
+// call in nanoseconds.
+static inline uint64_t bench_time_until(uint64_t min_ns, void (*run)(void *payload), void *payload)
+{
+    uint64_t iterations = 0, start = bench_now_ns(), elapsed;
+    do
+    {
+        run(payload);
+        iterations++;
+        elapsed = bench_now_ns() - start;
+    } while (elapsed < min_ns);
+    return elapsed / iterations;
+}
+
+// Peak resident set size of this process so far, in KiB.
+static inline long bench_peak_rss_kib(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+// Reads a whole file into a malloc'd buffer, exiting on failure.
+static inline char *bench_read_file(const char *path, uint32_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = malloc(size > 0 ? (size_t)size : 1);
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size)
+    {
+        perror(path);
+        exit(1);
+    }
+    fclose(file);
+    *length = (uint32_t)size;
+    return data;
+}
+
+// Reads `path` and repeats it until it is at least `size` bytes long, into a
+// malloc'd buffer; exits on failure. bench/corpus/functions.rad has no
+// preamble, so it stays a valid script when repeated.
+static inline char *bench_repeat_file(const char *path, uint32_t size, uint32_t *length)
+{
+    uint32_t unit_length;
+    char *unit = bench_read_file(path, &unit_length);
+    uint32_t copies = unit_length > 0 ? (size + unit_length - 1) / unit_length : 0;
+    char *data = malloc(copies > 0 ? (size_t)copies * unit_length : 1);
+    if (data == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+    for (uint32_t i = 0; i < copies; i++)
+    {
+        memcpy(data + (size_t)i * unit_length, unit, unit_length);
+    }
+    free(unit);
+    *length = copies * unit_length;
+    return data;
+}
+
+// A growing buffer for generated scripts.
+typedef struct
+{
+    char *data;
+    uint32_t length;
+    uint32_t capacity;
+} BenchBuffer;
+
+// Appends printf-style text to `buffer`, exiting if out of memory.
+static inline void bench_append(BenchBuffer *buffer, const char *format, ...)
+{
+    for (;;)
+    {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(buffer->data != NULL ? buffer->data + buffer->length : NULL,
+                          buffer->capacity - buffer->length, format, args);
+        va_end(args);
+        if (n < 0)
+        {
+            perror("vsnprintf");
+            exit(1);
+        }
+        if ((uint32_t)n < buffer->capacity - buffer->length)
+        {
+            buffer->length += (uint32_t)n;
+            return;
+        }
+        buffer->capacity = buffer->capacity * 2 + (uint32_t)n + 1;
+        buffer->data = realloc(buffer->data, buffer->capacity);
+        if (buffer->data == NULL)
+        {
+            perror("realloc");
+            exit(1);
+        }
+    }
+}
+
+static inline TSParser *bench_new_parser(void)
+{
+    TSParser *parser = ts_parser_new();
+    if (!ts_parser_set_language(parser, tree_sitter_rad()))
+    {
+        fprintf(stderr, "the linked tree-sitter library can't load this grammar\n");
+        exit(1);
+    }
+    return parser;
+}
+
+#endif // TREE_SITTER_RAD_BENCH_H_
@@ -0,0 +1,90 @@
+// Compares parsing with tree_sitter_rad_cache_load, on a miss (parse, then
+// serialize and store) and on a hit (map the stored tree).
+//
+//     cache_parse [SCRIPT]
+//
+// SCRIPT defaults to bench/corpus/functions.rad, repeated to each size. The
+// cache lives in a temporary directory that is removed afterwards.
+
+#include "bench.h"
+
+#include <inttypes.h>
+#include <unistd.h>
+
+#include "tree-sitter-rad-util.h"
+
+enum Mode
+{
+    PARSE,
+    MISS,
+    HIT,
+};
+
+static const char *const MODE_NAMES[] = {"parse", "miss", "hit"};
+
+typedef struct
+{
+    TSParser *parser;
+    const char *directory;
+    const char *path;
+    const char *source;
+    uint32_t length;
+    enum Mode mode;
+} Load;
+
+static void run_load(void *payload)
+{
+    const Load *load = payload;
+    if (load->mode == PARSE)
+    {
+        ts_tree_delete(ts_parser_parse_string(load->parser, NULL, load->source, load->length));
+        return;
+    }
+    if (load->mode == MISS)
+    {
+        unlink(load->path);
+    }
+    TSRadCachedCst result;
+    if (tree_sitter_rad_cache_load(load->directory, load->parser, load->source, load->length, &result) != 0 ||
+        result.hit != (load->mode == HIT))
+    {
+        fprintf(stderr, "unexpected cache %s\n", result.hit ? "hit" : "miss");
+        exit(1);
+    }
+    tree_sitter_rad_cache_release(&result);
+}
+
+int main(int argc, char **argv)
+{
+    const char *script = argc > 1 ? argv[1] : "bench/corpus/functions.rad";
+    char directory[] = "/tmp/rad-cache-XXXXXX";
+    if (mkdtemp(directory) == NULL)
+    {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    TSParser *parser = bench_new_parser();
+    uint64_t grammar_hash = tree_sitter_rad_grammar_hash(tree_sitter_rad());
+    for (uint32_t size = 1 << 10; size <= 1u << 20; size <<= 2)
+    {
+        uint32_t length;
+        char *source = bench_repeat_file(script, size, &length);
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%016" PRIx64 "%016" PRIx64 ".rcst", directory, grammar_hash,
+                 tree_sitter_rad_source_hash(source, length));
+
+        for (enum Mode mode = PARSE; mode <= HIT; mode++)
+        {
+            Load load = {parser, directory, path, source, length, mode};
+            uint64_t ns = bench_time_until(BENCH_MIN_RUN_NS, run_load, &load);
+            printf("{\"bench\":\"cache_parse\",\"mode\":\"%s\",\"bytes\":%u,\"ns_per_load\":%llu,\"mb_per_s\":%.2f}\n",
+                   MODE_NAMES[mode], length, (unsigned long long)ns, (double)length * 1e3 / (double)ns);
+        }
+        unlink(path);
+        free(source);
+    }
+    rmdir(directory);
+    ts_parser_delete(parser);
+    return 0;
+}
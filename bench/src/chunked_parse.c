@@ -0,0 +1,127 @@
+// Times tree_sitter_rad_parse_chunked on 1 thread up to one per CPU, against
+// a sequential parse written out as a CST, after checking that both produce
+// the same CST.
+//
+//     chunked_parse [SCRIPT [MIB]]
+//
+// SCRIPT defaults to bench/corpus/functions.rad, repeated to MIB MiB (32 by
+// default). Exits with status 1 if a chunked CST differs from the sequential
+// one.
+
+#include "bench.h"
+
+#include <string.h>
+#include <unistd.h>
+
+#include "tree-sitter-rad-util.h"
+
+static size_t parse_sequential(TSParser *parser, const char *source, uint32_t length, void **data)
+{
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source, length);
+    size_t size = tree_sitter_rad_cst_write(tree, source, length, false, data);
+    ts_tree_delete(tree);
+    return size;
+}
+
+typedef struct
+{
+    TSParser *parser;
+    const char *source;
+    uint32_t length;
+    uint32_t threads; // 0 for a sequential parse.
+} Parse;
+
+static void run_parse(void *payload)
+{
+    const Parse *parse = payload;
+    void *data;
+    if (parse->threads == 0)
+    {
+        parse_sequential(parse->parser, parse->source, parse->length, &data);
+    }
+    else
+    {
+        tree_sitter_rad_parse_chunked(tree_sitter_rad(), parse->source, parse->length, parse->threads, false, &data);
+    }
+    free(data);
+}
+
+// Returns whether both CSTs are the same, reporting the first difference.
+static bool same_cst(const void *expected, size_t expected_size, const void *actual, size_t actual_size,
+                     uint32_t threads)
+{
+    TSRadCst a, b;
+    if (!tree_sitter_rad_cst_open(&a, expected, expected_size) || !tree_sitter_rad_cst_open(&b, actual, actual_size))
+    {
+        fprintf(stderr, "threads=%u: unreadable CST\n", threads);
+        return false;
+    }
+    if (a.node_count != b.node_count)
+    {
+        fprintf(stderr, "threads=%u: %u nodes, expected %u\n", threads, b.node_count, a.node_count);
+        return false;
+    }
+    for (uint32_t i = 0; i < a.node_count; i++)
+    {
+        if (memcmp(&a.nodes[i], &b.nodes[i], sizeof(TSRadCstNode)) != 0)
+        {
+            fprintf(stderr, "threads=%u: node %u differs: kind %u [%u, %u), expected kind %u [%u, %u)\n", threads, i,
+                    b.nodes[i].kind_id, b.nodes[i].start_byte, b.nodes[i].end_byte, a.nodes[i].kind_id,
+                    a.nodes[i].start_byte, a.nodes[i].end_byte);
+            return false;
+        }
+    }
+    if (expected_size != actual_size || memcmp(expected, actual, sizeof(TSRadCstHeader)) != 0)
+    {
+        fprintf(stderr, "threads=%u: header differs\n", threads);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t size = (argc > 2 ? (uint32_t)atoi(argv[2]) : 32) << 20;
+    uint32_t length;
+    char *source = bench_repeat_file(argc > 1 ? argv[1] : "bench/corpus/functions.rad", size, &length);
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t max_threads = cpus > 1 ? (uint32_t)cpus : 1;
+
+    TSParser *parser = bench_new_parser();
+    void *expected;
+    size_t expected_size = parse_sequential(parser, source, length, &expected);
+
+    Parse sequential = {parser, source, length, 0};
+    uint64_t sequential_ns = bench_time_until(BENCH_MIN_RUN_NS, run_parse, &sequential);
+    printf("{\"bench\":\"chunked_parse\",\"mode\":\"sequential\",\"threads\":1,\"bytes\":%u,\"ns_per_parse\":%llu,"
+           "\"mb_per_s\":%.2f,\"speedup\":1.00}\n",
+           length, (unsigned long long)sequential_ns, (double)length * 1e3 / (double)sequential_ns);
+
+    for (uint32_t threads = 1;; threads = threads * 2 < max_threads ? threads * 2 : max_threads)
+    {
+        void *data;
+        size_t data_size = tree_sitter_rad_parse_chunked(tree_sitter_rad(), source, length, threads, false, &data);
+        if (data_size == 0 || !same_cst(expected, expected_size, data, data_size, threads))
+        {
+            return 1;
+        }
+        free(data);
+
+        Parse chunked = {parser, source, length, threads};
+        uint64_t ns = bench_time_until(BENCH_MIN_RUN_NS, run_parse, &chunked);
+        printf("{\"bench\":\"chunked_parse\",\"mode\":\"chunked\",\"threads\":%u,\"bytes\":%u,\"ns_per_parse\":%llu,"
+               "\"mb_per_s\":%.2f,\"speedup\":%.2f,\"peak_rss_kib\":%ld}\n",
+               threads, length, (unsigned long long)ns, (double)length * 1e3 / (double)ns,
+               (double)sequential_ns / (double)ns, bench_peak_rss_kib());
+        if (threads == max_threads)
+        {
+            break;
+        }
+    }
+
+    free(expected);
+    ts_parser_delete(parser);
+    free(source);
+    return 0;
+}
@@ -0,0 +1,136 @@
+// Measures startup parsing for a multi-command tool: a full parse against
+// tree_sitter_rad_parse_command for one subcommand, next to a script that
+// holds only that subcommand, as the number of subcommands grows.
+//
+//     command_parse
+//
+// Exits with status 1 if a function the command reaches through a body too
+// short to skip is left unparsed.
+
+#include "bench.h"
+
+#include <string.h>
+
+#include "tree-sitter-rad-util.h"
+
+// A tool with `commands` subcommands, each calling its own function, which
+// calls a helper.
+static BenchBuffer generate(uint32_t commands)
+{
+    BenchBuffer buffer = {0};
+    bench_append(&buffer, "#!/usr/bin/env rad\n---\nA generated multi-command tool.\n---\n");
+    for (uint32_t i = 0; i < commands; i++)
+    {
+        bench_append(&buffer,
+                     "command step%u:\n"
+                     "    ---\n"
+                     "    Runs step %u.\n"
+                     "    ---\n"
+                     "    target str = \"all\" # What to run it on.\n"
+                     "    count n int = 1 # How many times.\n"
+                     "    calls run_step%u\n\n",
+                     i, i, i);
+    }
+    for (uint32_t i = 0; i < commands; i++)
+    {
+        bench_append(&buffer,
+                     "fn run_step%u():\n"
+                     "    for j in range(count):\n"
+                     "        result = helper%u(target, j)\n"
+                     "        if result:\n"
+                     "            print(\"step %u: {target} {j} -> {result}\")\n\n"
+                     "fn helper%u(target, j):\n"
+                     "    parts = [target, str(j)]\n"
+                     "    return join(parts, \"-\")\n\n",
+                     i, i, i, i);
+    }
+    return buffer;
+}
+
+typedef struct
+{
+    TSParser *parser;
+    const BenchBuffer *source;
+    const char *command; // NULL for a full parse.
+} Parse;
+
+static void run_parse(void *payload)
+{
+    const Parse *parse = payload;
+    if (parse->command != NULL)
+    {
+        tree_sitter_rad_lazy_tree_delete(tree_sitter_rad_parse_command(parse->parser, parse->source->data,
+                                                                       parse->source->length, &parse->command, 1));
+    }
+    else
+    {
+        ts_tree_delete(ts_parser_parse_string(parse->parser, NULL, parse->source->data, parse->source->length));
+    }
+}
+
+static uint64_t time_parse(TSParser *parser, const BenchBuffer *source, const char *command)
+{
+    Parse parse = {parser, source, command};
+    return bench_time_until(BENCH_MIN_RUN_NS, run_parse, &parse);
+}
+
+// A command calls `relay`, whose body is shorter than its placeholder and so
+// is parsed anyway, and `relay` calls `x`, which has to be parsed too.
+static bool check_short_callee(TSParser *parser)
+{
+    const char *source = "#!/usr/bin/env rad\n---\nRelays to a worker.\n---\n"
+                         "command go:\n"
+                         "    calls relay\n\n"
+                         "fn relay():\n"
+                         "    x()\n\n"
+                         "fn x():\n"
+                         "    for j in range(10):\n"
+                         "        print(\"working {j}\")\n\n"
+                         "fn unused():\n"
+                         "    for j in range(10):\n"
+                         "        print(\"unused {j}\")\n";
+    const char *command = "go";
+    TSRadLazyTree *tree = tree_sitter_rad_parse_command(parser, source, (uint32_t)strlen(source), &command, 1);
+    if (tree == NULL)
+    {
+        fprintf(stderr, "check_short_callee: parse failed\n");
+        return false;
+    }
+    uint32_t work = (uint32_t)(strstr(source, "working") - source);
+    uint32_t unused = (uint32_t)(strstr(source, "unused {j}") - source);
+    bool ok = tree_sitter_rad_lazy_tree_body_at(tree, work) == UINT32_MAX &&
+              tree_sitter_rad_lazy_tree_body_at(tree, unused) != UINT32_MAX;
+    if (!ok)
+    {
+        fprintf(stderr, "check_short_callee: x should be parsed and unused skipped\n");
+    }
+    tree_sitter_rad_lazy_tree_delete(tree);
+    return ok;
+}
+
+static void report(const char *mode, uint32_t commands, const BenchBuffer *source, uint64_t ns)
+{
+    printf("{\"bench\":\"command_parse\",\"mode\":\"%s\",\"commands\":%u,\"bytes\":%u,\"ns_per_parse\":%llu}\n",
+           mode, commands, source->length, (unsigned long long)ns);
+}
+
+int main(void)
+{
+    TSParser *parser = bench_new_parser();
+    if (!check_short_callee(parser))
+    {
+        return 1;
+    }
+    BenchBuffer single = generate(1);
+    report("single", 1, &single, time_parse(parser, &single, NULL));
+    for (uint32_t commands = 4; commands <= 256; commands *= 4)
+    {
+        BenchBuffer tool = generate(commands);
+        report("full", commands, &tool, time_parse(parser, &tool, NULL));
+        report("command", commands, &tool, time_parse(parser, &tool, "step0"));
+        free(tool.data);
+    }
+    free(single.data);
+    ts_parser_delete(parser);
+    return 0;
+}
@@ -0,0 +1,248 @@
+// Parses every script in the benchmark corpus, plus generated ones, and
+// prints one JSON line per script with throughput, peak memory and the
+// parser's allocations, so runs against two grammar versions can be diffed.
+//
+//     corpus_parse [DIR]
+//
+// DIR defaults to bench/corpus; its .rad files are parsed in name order.
+// Each script is parsed in a process of its own, so peak_rss_kib is that
+// script's alone. allocations and allocated_bytes count the calls made
+// through the tree-sitter allocator, and the bytes requested, during the
+// first parse with a new parser, as a single run of a script makes. The
+// generated scripts are:
+//
+//   generated/functions_8mib  bench/corpus/functions.rad repeated to 8 MiB
+//   generated/heredoc_4mib    4 MiB of mostly multi-line """ strings
+//   generated/nested_64       functions with blocks and brackets 64 deep
+//   generated/args_2000       an args block of 2000 flags
+//   generated/flat_100k       100k assignments, as a code generator writes
+
+#include "bench.h"
+
+#include <dirent.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+static uint64_t allocations, allocated_bytes;
+
+static void *count_malloc(size_t size)
+{
+    allocations++;
+    allocated_bytes += size;
+    return malloc(size);
+}
+
+static void *count_calloc(size_t count, size_t size)
+{
+    allocations++;
+    allocated_bytes += count * size;
+    return calloc(count, size);
+}
+
+static void *count_realloc(void *data, size_t size)
+{
+    allocations++;
+    allocated_bytes += size;
+    return realloc(data, size);
+}
+
+static BenchBuffer functions_8mib(void)
+{
+    BenchBuffer buffer = {0};
+    buffer.data = bench_repeat_file("bench/corpus/functions.rad", 8u << 20, &buffer.length);
+    buffer.capacity = buffer.length;
+    return buffer;
+}
+
+static BenchBuffer heredoc_4mib(void)
+{
+    BenchBuffer buffer = {0};
+    bench_append(&buffer, "name = \"reader\"\n\n");
+    for (uint32_t i = 0; buffer.length < 4u << 20; i++)
+    {
+        bench_append(&buffer, "doc_%u = \"\"\"\n", i);
+        for (uint32_t line = 0; line < 24; line++)
+        {
+            bench_append(&buffer,
+                         "    Line %u of section %u, written for {name}. Most of this input is string\n"
+                         "    content, with the occasional \"quoted\" phrase and {i} interpolation.\n",
+                         line, i);
+        }
+        bench_append(&buffer, "    \"\"\"\nprint(doc_%u)\n\n", i);
+    }
+    return buffer;
+}
+
+static BenchBuffer nested_64(void)
+{
+    BenchBuffer buffer = {0};
+    for (uint32_t i = 0; buffer.length < 1u << 20; i++)
+    {
+        bench_append(&buffer, "fn deep_%u(x):\n", i);
+        uint32_t depth = 1;
+        for (; depth < 64; depth++)
+        {
+            bench_append(&buffer, "%*sif x > %u:\n", (int)depth * 4, "", depth);
+        }
+        bench_append(&buffer, "%*sreturn x\n", (int)depth * 4, "");
+        bench_append(&buffer, "    return 0\n\nnested_%u = ", i);
+        for (uint32_t j = 0; j < 64; j++)
+        {
+            bench_append(&buffer, j % 2 == 0 ? "[" : "(");
+        }
+        bench_append(&buffer, "%u", i);
+        for (uint32_t j = 64; j > 0; j--)
+        {
+            bench_append(&buffer, (j - 1) % 2 == 0 ? "]" : ")");
+        }
+        bench_append(&buffer, "\nprint(deep_%u(nested_%u))\n\n", i, i);
+    }
+    return buffer;
+}
+
+static BenchBuffer args_2000(void)
+{
+    BenchBuffer buffer = {0};
+    bench_append(&buffer, "#!/usr/bin/env rad\n---\nA tool with a very large number of flags.\n---\nargs:\n");
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        bench_append(&buffer, "    option_%u int = %u # Option number %u.\n", i, i, i);
+    }
+    bench_append(&buffer, "\n");
+    for (uint32_t i = 0; i < 2000; i += 10)
+    {
+        bench_append(&buffer, "    option_%u range [0, %u]\n", i, i * 2 + 1);
+    }
+    bench_append(&buffer, "\nprint(option_0 + option_1999)\n");
+    return buffer;
+}
+
+static BenchBuffer flat_100k(void)
+{
+    BenchBuffer buffer = {0};
+    for (uint32_t i = 0; i < 100000; i++)
+    {
+        bench_append(&buffer, "value_%u = compute(%u, \"key_%u\", [%u, %u]) + %u\n", i, i, i, i % 7, i % 13, i);
+    }
+    return buffer;
+}
+
+static const struct
+{
+    const char *name;
+    BenchBuffer (*generate)(void);
+} GENERATED[] = {
+    {"generated/functions_8mib", functions_8mib}, {"generated/heredoc_4mib", heredoc_4mib},
+    {"generated/nested_64", nested_64},           {"generated/args_2000", args_2000},
+    {"generated/flat_100k", flat_100k},
+};
+
+typedef struct
+{
+    TSParser *parser;
+    const char *source;
+    uint32_t length;
+} Parse;
+
+static void run_parse(void *payload)
+{
+    Parse *parse = payload;
+    ts_tree_delete(ts_parser_parse_string(parse->parser, NULL, parse->source, parse->length));
+}
+
+static void measure(const char *name, const char *source, uint32_t length)
+{
+    ts_set_allocator(count_malloc, count_calloc, count_realloc, free);
+    TSParser *parser = bench_new_parser();
+
+    allocations = allocated_bytes = 0;
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source, length);
+    uint64_t parse_allocations = allocations, parse_bytes = allocated_bytes;
+    TSNode root = ts_tree_root_node(tree);
+    uint32_t nodes = ts_node_descendant_count(root);
+    bool has_error = ts_node_has_error(root);
+    ts_tree_delete(tree);
+
+    Parse parse = {parser, source, length};
+    double ns = (double)bench_time_until(BENCH_MIN_RUN_NS, run_parse, &parse);
+
+    printf("{\"bench\":\"corpus_parse\",\"script\":\"%s\",\"bytes\":%u,\"nodes\":%u,\"ns_per_parse\":%.0f,"
+           "\"mb_per_s\":%.2f,\"nodes_per_s\":%.0f,\"allocations\":%llu,\"allocated_bytes\":%llu,"
+           "\"peak_rss_kib\":%ld,\"has_error\":%s}\n",
+           name, length, nodes, ns, (double)length * 1e3 / ns, (double)nodes * 1e9 / ns,
+           (unsigned long long)parse_allocations, (unsigned long long)parse_bytes, bench_peak_rss_kib(),
+           has_error ? "true" : "false");
+    fflush(stdout);
+    ts_parser_delete(parser);
+}
+
+// Runs `measure` in a child process. Returns false if the child fails.
+static bool measure_in_child(const char *dir, const char *name, BenchBuffer (*generate)(void))
+{
+    pid_t child = fork();
+    if (child == 0)
+    {
+        BenchBuffer source;
+        if (generate != NULL)
+        {
+            source = generate();
+        }
+        else
+        {
+            char path[4096];
+            snprintf(path, sizeof(path), "%s/%s", dir, name);
+            source.data = bench_read_file(path, &source.length);
+        }
+        measure(name, source.data, source.length);
+        free(source.data);
+        _exit(0);
+    }
+    int status;
+    return child > 0 && waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static int compare_names(const void *a, const void *b) { return strcmp(*(char *const *)a, *(char *const *)b); }
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : "bench/corpus";
+    DIR *entries = opendir(dir);
+    if (entries == NULL)
+    {
+        perror(dir);
+        return 1;
+    }
+    char **names = NULL;
+    size_t count = 0;
+    for (struct dirent *entry; (entry = readdir(entries)) != NULL;)
+    {
+        size_t n = strlen(entry->d_name);
+        if (n > 4 && strcmp(entry->d_name + n - 4, ".rad") == 0)
+        {
+            names = realloc(names, (count + 1) * sizeof(char *));
+            names[count++] = strdup(entry->d_name);
+        }
+    }
+    closedir(entries);
+    qsort(names, count, sizeof(char *), compare_names);
+
+    int status = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!measure_in_child(dir, names[i], NULL))
+        {
+            status = 1;
+        }
+        free(names[i]);
+    }
+    free(names);
+    for (size_t i = 0; i < sizeof(GENERATED) / sizeof(GENERATED[0]); i++)
+    {
+        if (!measure_in_child(dir, GENERATED[i].name, GENERATED[i].generate))
+        {
+            status = 1;
+        }
+    }
+    return status;
+}
@@ -0,0 +1,68 @@
+// Measures what `rad script --help` waits for: a full parse against
+// tree_sitter_rad_parse_preamble, for scripts of growing length with the same
+// preamble.
+//
+//     help_latency [PREAMBLE_SCRIPT [BODY_SCRIPT]]
+//
+// The scripts default to bench/corpus/commands.rad, whose statements are
+// followed by copies of bench/corpus/functions.rad.
+
+#include "bench.h"
+
+#include <string.h>
+
+#include "tree-sitter-rad-util.h"
+
+typedef struct
+{
+    TSParser *parser;
+    const char *source;
+    uint32_t length;
+    int preamble;
+    uint64_t nodes;
+} Parse;
+
+static void run_parse(void *payload)
+{
+    Parse *parse = payload;
+    TSTree *tree = parse->preamble ? tree_sitter_rad_parse_preamble(parse->parser, parse->source, parse->length)
+                                   : ts_parser_parse_string(parse->parser, NULL, parse->source, parse->length);
+    parse->nodes = ts_node_descendant_count(ts_tree_root_node(tree));
+    ts_tree_delete(tree);
+}
+
+int main(int argc, char **argv)
+{
+    const char *head_path = argc > 1 ? argv[1] : "bench/corpus/commands.rad";
+    const char *body_path = argc > 2 ? argv[2] : "bench/corpus/functions.rad";
+    uint32_t head_length, body_length;
+    char *head = bench_read_file(head_path, &head_length);
+    char *body = bench_read_file(body_path, &body_length);
+
+    TSParser *parser = bench_new_parser();
+    for (uint32_t size = 1 << 10; size <= 16u << 20; size <<= 2)
+    {
+        uint32_t copies = size > head_length ? (size - head_length + body_length - 1) / body_length : 0;
+        uint32_t length = head_length + copies * body_length;
+        char *source = malloc(length);
+        memcpy(source, head, head_length);
+        for (uint32_t i = 0; i < copies; i++)
+        {
+            memcpy(source + head_length + i * body_length, body, body_length);
+        }
+
+        for (int preamble = 0; preamble <= 1; preamble++)
+        {
+            Parse parse = {parser, source, length, preamble, 0};
+            uint64_t ns = bench_time_until(BENCH_MIN_RUN_NS, run_parse, &parse);
+            printf("{\"bench\":\"help_latency\",\"mode\":\"%s\",\"bytes\":%u,\"nodes\":%llu,"
+                   "\"ns_per_parse\":%llu}\n",
+                   preamble ? "preamble" : "full", length, (unsigned long long)parse.nodes, (unsigned long long)ns);
+        }
+        free(source);
+    }
+    ts_parser_delete(parser);
+    free(head);
+    free(body);
+    return 0;
+}
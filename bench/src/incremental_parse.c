@@ -0,0 +1,465 @@
+// Replays edit traces against Rad scripts the way an editor would: each edit
+// is applied with ts_tree_edit and the script reparsed with the old tree.
+// For each trace it reports the latency of edit plus reparse, the share of
+// the new tree's nodes inside a parent reused from the old one, and how many
+// bytes the changed ranges cover, then checks the final tree against a fresh
+// parse.
+//
+// A node's id is the address of its slot in its parent's children, not of
+// the subtree itself, so an id shared by both trees means the parent was
+// reused. A reused subtree under a rebuilt parent doesn't count, nor does
+// the root, which makes the share a lower bound on what the parser reused.
+//
+//     incremental_parse [SCRIPT TRACE]
+//
+// Without arguments, runs the synthetic traces below, each against its
+// corpus script followed by copies of bench/corpus/functions.rad up to
+// 256 KiB, so reuse is measured against a tree of realistic size. TRACE has
+// one edit per line, `START DELETED TEXT`: delete DELETED bytes at byte
+// START and insert TEXT, which follows a single space and may itself start
+// with spaces, and in which `\n`, `\t` and `\\` are escapes. Exits
+// with status 1 if an incremental tree differs from a fresh parse.
+
+#include "bench.h"
+
+#include <string.h>
+
+#define SCRIPT_SIZE (256 * 1024)
+#define REPLAYS 5
+
+typedef struct
+{
+    char *data;
+    uint32_t length;
+    uint32_t capacity;
+} Text;
+
+typedef struct
+{
+    uint32_t start;
+    uint32_t deleted;
+    char *text;
+    uint32_t length;
+} Edit;
+
+typedef struct
+{
+    const char *name;
+    Text original;
+    // The source as of the last edit added.
+    Text work;
+    Edit *edits;
+    uint32_t count;
+    uint32_t capacity;
+} Trace;
+
+static void text_splice(Text *text, uint32_t start, uint32_t deleted, const char *insert, uint32_t length)
+{
+    uint32_t new_length = text->length - deleted + length;
+    if (new_length > text->capacity)
+    {
+        text->capacity = new_length * 2;
+        text->data = realloc(text->data, text->capacity);
+    }
+    memmove(text->data + start + length, text->data + start + deleted, text->length - start - deleted);
+    memcpy(text->data + start, insert, length);
+    text->length = new_length;
+}
+
+static Text text_copy(const Text *text)
+{
+    Text copy = {malloc(text->capacity), text->length, text->capacity};
+    memcpy(copy.data, text->data, text->length);
+    return copy;
+}
+
+static void add_edit(Trace *trace, uint32_t start, uint32_t deleted, const char *text, uint32_t length)
+{
+    if (trace->count == trace->capacity)
+    {
+        trace->capacity = trace->capacity ? trace->capacity * 2 : 64;
+        trace->edits = realloc(trace->edits, trace->capacity * sizeof(Edit));
+    }
+    Edit *edit = &trace->edits[trace->count++];
+    *edit = (Edit){start, deleted, malloc(length + 1), length};
+    memcpy(edit->text, text, length);
+    text_splice(&trace->work, start, deleted, text, length);
+}
+
+// Types `text` a byte at a time at `*cursor`, leaving the cursor after it.
+static void type_text(Trace *trace, uint32_t *cursor, const char *text)
+{
+    for (; *text != '\0'; text++)
+    {
+        add_edit(trace, (*cursor)++, 0, text, 1);
+    }
+}
+
+// Returns the offset of `anchor` in the trace's current source, exiting if
+// it isn't there.
+static uint32_t find(const Trace *trace, const char *anchor)
+{
+    size_t n = strlen(anchor);
+    for (uint32_t i = 0; i + n <= trace->work.length; i++)
+    {
+        if (memcmp(trace->work.data + i, anchor, n) == 0)
+        {
+            return i;
+        }
+    }
+    fprintf(stderr, "%s: no \"%s\" in the script\n", trace->name, anchor);
+    exit(1);
+}
+
+static Trace new_trace(const char *name, const char *path, const char *padding, uint32_t padding_length)
+{
+    Trace trace = {.name = name};
+    trace.original.data = bench_read_file(path, &trace.original.length);
+    trace.original.capacity = trace.original.length;
+    while (padding_length > 0 && trace.original.length < SCRIPT_SIZE)
+    {
+        text_splice(&trace.original, trace.original.length, 0, padding, padding_length);
+    }
+    trace.work = text_copy(&trace.original);
+    return trace;
+}
+
+// Types into a string literal.
+static Trace string_typing(const char *padding, uint32_t padding_length)
+{
+    Trace trace = new_trace("string_typing", "bench/corpus/functions.rad", padding, padding_length);
+    uint32_t cursor = find(&trace, "print(\"Sum of ") + 14;
+    type_text(&trace, &cursor, "the running total of ");
+    return trace;
+}
+
+// Adds two flags to an `args` block, pressing enter at the end of the last
+// one and typing each line.
+static Trace args_lines(const char *padding, uint32_t padding_length)
+{
+    Trace trace = new_trace("args_lines", "bench/corpus/args_heavy.rad", padding, padding_length);
+    uint32_t cursor = find(&trace, "# Feature toggles.") + 18;
+    type_text(&trace, &cursor, "\n    cache_dir d str = \"/tmp/cache\" # Where builds are cached.");
+    type_text(&trace, &cursor, "\n    offline o bool # Never touch the network.");
+    return trace;
+}
+
+// Wraps a loop in an `if`, then indents the loop a line at a time.
+static Trace indent_block(const char *padding, uint32_t padding_length)
+{
+    Trace trace = new_trace("indent_block", "bench/corpus/functions.rad", padding, padding_length);
+    uint32_t line = find(&trace, "\nwhile count < 10:") + 1;
+    add_edit(&trace, line, 0, "if count == 0:\n", 15);
+    line += 15;
+    do
+    {
+        add_edit(&trace, line, 0, "    ", 4);
+        line = (uint32_t)((char *)memchr(trace.work.data + line, '\n', trace.work.length - line) - trace.work.data) + 1;
+    } while (trace.work.data[line] == ' ');
+    return trace;
+}
+
+// Extends the field list of a `rad` block and adds a sort to it.
+static Trace rad_block(const char *padding, uint32_t padding_length)
+{
+    Trace trace = new_trace("rad_block", "bench/corpus/report.rad", padding, padding_length);
+    uint32_t cursor = find(&trace, "rad url:\n    fields number, title") + 33;
+    type_text(&trace, &cursor, ", author, labels");
+    type_text(&trace, &cursor, "\n    sort author");
+    return trace;
+}
+
+// Reads a recorded trace.
+static Trace read_trace(const char *script, const char *path)
+{
+    Trace trace = new_trace(path, script, NULL, 0);
+    uint32_t length;
+    char *data = bench_read_file(path, &length);
+    // Room to end the last line with a NUL.
+    data = realloc(data, length + 1);
+    for (char *line = data; line < data + length;)
+    {
+        char *end = memchr(line, '\n', (size_t)(data + length - line));
+        end = end != NULL ? end : data + length;
+        *end = '\0';
+        unsigned start, deleted;
+        int text;
+        if (sscanf(line, "%u %u%n", &start, &deleted, &text) < 2 || start + deleted > trace.work.length)
+        {
+            fprintf(stderr, "%s: bad edit: %s\n", path, line);
+            exit(1);
+        }
+        // One space separates TEXT, whose own leading whitespace is kept.
+        if (line[text] == ' ')
+        {
+            text++;
+        }
+        char *in = line + text, *out = in;
+        while (*in != '\0')
+        {
+            if (*in == '\\' && in[1] != '\0')
+            {
+                in++;
+                *out++ = *in == 'n' ? '\n' : *in == 't' ? '\t' : *in;
+                in++;
+            }
+            else
+            {
+                *out++ = *in++;
+            }
+        }
+        add_edit(&trace, start, deleted, line + text, (uint32_t)(out - (line + text)));
+        line = end + 1;
+    }
+    free(data);
+    return trace;
+}
+
+static TSPoint point_at(const Text *text, uint32_t byte)
+{
+    TSPoint point = {0, 0};
+    for (uint32_t i = 0; i < byte; i++)
+    {
+        if (text->data[i] == '\n')
+        {
+            point.row++;
+            point.column = 0;
+        }
+        else
+        {
+            point.column++;
+        }
+    }
+    return point;
+}
+
+// An open-addressed set of node ids.
+typedef struct
+{
+    const void **slots;
+    uint32_t mask;
+} IdSet;
+
+static uint32_t id_slot(const IdSet *set, const void *id)
+{
+    uint64_t hash = ((uint64_t)(uintptr_t)id >> 3) * 0x9e3779b97f4a7c15ull;
+    uint32_t slot = (uint32_t)(hash >> 32) & set->mask;
+    while (set->slots[slot] != NULL && set->slots[slot] != id)
+    {
+        slot = (slot + 1) & set->mask;
+    }
+    return slot;
+}
+
+// Calls `visit` on every node of `tree`, in pre-order.
+static void walk(const TSTree *tree, void (*visit)(TSNode node, void *payload), void *payload)
+{
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    for (;;)
+    {
+        visit(ts_tree_cursor_current_node(&cursor), payload);
+        if (ts_tree_cursor_goto_first_child(&cursor))
+        {
+            continue;
+        }
+        while (!ts_tree_cursor_goto_next_sibling(&cursor))
+        {
+            if (!ts_tree_cursor_goto_parent(&cursor))
+            {
+                ts_tree_cursor_delete(&cursor);
+                return;
+            }
+        }
+    }
+}
+
+static void add_id(TSNode node, void *payload)
+{
+    IdSet *set = payload;
+    set->slots[id_slot(set, node.id)] = node.id;
+}
+
+typedef struct
+{
+    const IdSet *old_ids;
+    uint32_t nodes;
+    uint32_t reused;
+} ReuseCount;
+
+// Counts the nodes whose parent was reused; see the top of the file.
+static void count_reused(TSNode node, void *payload)
+{
+    ReuseCount *count = payload;
+    count->nodes++;
+    count->reused += count->old_ids->slots[id_slot(count->old_ids, node.id)] != NULL;
+}
+
+typedef struct
+{
+    uint64_t ns;
+    double reused;
+    uint64_t changed_bytes;
+} EditResult;
+
+// Replays `trace` once, storing what each edit cost in `results`. Returns
+// false if the final tree differs from a fresh parse.
+static bool replay(TSParser *parser, const Trace *trace, EditResult *results)
+{
+    Text source = text_copy(&trace->original);
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source.data, source.length);
+    for (uint32_t i = 0; i < trace->count; i++)
+    {
+        const Edit *edit = &trace->edits[i];
+        TSInputEdit input_edit = {
+            .start_byte = edit->start,
+            .old_end_byte = edit->start + edit->deleted,
+            .new_end_byte = edit->start + edit->length,
+            .start_point = point_at(&source, edit->start),
+            .old_end_point = point_at(&source, edit->start + edit->deleted),
+        };
+        text_splice(&source, edit->start, edit->deleted, edit->text, edit->length);
+        input_edit.new_end_point = point_at(&source, input_edit.new_end_byte);
+
+        uint64_t start = bench_now_ns();
+        ts_tree_edit(tree, &input_edit);
+        uint64_t edited = bench_now_ns();
+
+        // What the parser may reuse: the edited tree's nodes.
+        uint32_t old_nodes = ts_node_descendant_count(ts_tree_root_node(tree)), capacity = 1;
+        while (capacity < old_nodes * 2)
+        {
+            capacity *= 2;
+        }
+        IdSet old_ids = {calloc(capacity, sizeof(void *)), capacity - 1};
+        walk(tree, add_id, &old_ids);
+
+        uint64_t parse_start = bench_now_ns();
+        TSTree *new_tree = ts_parser_parse_string(parser, tree, source.data, source.length);
+        uint64_t parsed = bench_now_ns();
+
+        ReuseCount count = {.old_ids = &old_ids};
+        walk(new_tree, count_reused, &count);
+        uint32_t range_count;
+        TSRange *ranges = ts_tree_get_changed_ranges(tree, new_tree, &range_count);
+        uint64_t changed_bytes = 0;
+        for (uint32_t r = 0; r < range_count; r++)
+        {
+            changed_bytes += ranges[r].end_byte - ranges[r].start_byte;
+        }
+        free(ranges);
+        free(old_ids.slots);
+
+        results[i] = (EditResult){
+            .ns = (edited - start) + (parsed - parse_start),
+            .reused = (double)count.reused / (double)count.nodes,
+            .changed_bytes = changed_bytes,
+        };
+        ts_tree_delete(tree);
+        tree = new_tree;
+    }
+
+    TSTree *fresh = ts_parser_parse_string(parser, NULL, source.data, source.length);
+    char *expected = ts_node_string(ts_tree_root_node(fresh));
+    char *actual = ts_node_string(ts_tree_root_node(tree));
+    bool same = strcmp(expected, actual) == 0;
+    if (!same)
+    {
+        fprintf(stderr, "%s: the incremental tree differs from a fresh parse\n", trace->name);
+    }
+    free(expected);
+    free(actual);
+    ts_tree_delete(fresh);
+    ts_tree_delete(tree);
+    free(source.data);
+    return same;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static bool run_trace(TSParser *parser, const Trace *trace)
+{
+    EditResult *results = malloc(trace->count * sizeof(EditResult));
+    uint64_t *best = malloc(trace->count * sizeof(uint64_t));
+    for (uint32_t replay_index = 0; replay_index < REPLAYS; replay_index++)
+    {
+        if (!replay(parser, trace, results))
+        {
+            free(best);
+            free(results);
+            return false;
+        }
+        for (uint32_t i = 0; i < trace->count; i++)
+        {
+            best[i] = replay_index == 0 || results[i].ns < best[i] ? results[i].ns : best[i];
+        }
+    }
+
+    double reused = 0, min_reused = 1, changed_bytes = 0;
+    uint64_t total_ns = 0;
+    for (uint32_t i = 0; i < trace->count; i++)
+    {
+        reused += results[i].reused;
+        min_reused = results[i].reused < min_reused ? results[i].reused : min_reused;
+        changed_bytes += (double)results[i].changed_bytes;
+        total_ns += best[i];
+    }
+    qsort(best, trace->count, sizeof(uint64_t), compare_u64);
+    uint32_t n = trace->count;
+    printf("{\"bench\":\"incremental_parse\",\"trace\":\"%s\",\"bytes\":%u,\"edits\":%u,\"mean_us\":%.1f,"
+           "\"p50_us\":%.1f,\"p95_us\":%.1f,\"max_us\":%.1f,\"mean_in_reused\":%.4f,\"min_in_reused\":%.4f,"
+           "\"mean_changed_bytes\":%.1f}\n",
+           trace->name, trace->original.length, n, (double)total_ns / n / 1e3, (double)best[n / 2] / 1e3,
+           (double)best[(n * 95) / 100] / 1e3, (double)best[n - 1] / 1e3, reused / n, min_reused,
+           changed_bytes / n);
+    free(best);
+    free(results);
+    return true;
+}
+
+static void free_trace(Trace *trace)
+{
+    for (uint32_t i = 0; i < trace->count; i++)
+    {
+        free(trace->edits[i].text);
+    }
+    free(trace->edits);
+    free(trace->work.data);
+    free(trace->original.data);
+}
+
+int main(int argc, char **argv)
+{
+    TSParser *parser = bench_new_parser();
+    Trace traces[4];
+    uint32_t count = 0;
+    if (argc > 2)
+    {
+        traces[count++] = read_trace(argv[1], argv[2]);
+    }
+    else
+    {
+        uint32_t padding_length;
+        char *padding = bench_read_file("bench/corpus/functions.rad", &padding_length);
+        traces[count++] = string_typing(padding, padding_length);
+        traces[count++] = args_lines(padding, padding_length);
+        traces[count++] = indent_block(padding, padding_length);
+        traces[count++] = rad_block(padding, padding_length);
+        free(padding);
+    }
+
+    int status = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (traces[i].count > 0 && !run_trace(parser, &traces[i]))
+        {
+            status = 1;
+        }
+        free_trace(&traces[i]);
+    }
+    ts_parser_delete(parser);
+    return status;
+}
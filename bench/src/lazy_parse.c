@@ -0,0 +1,95 @@
+// Compares a full parse with tree_sitter_rad_parse_lazy, which skips the
+// bodies of top-level definitions, and times parsing one body on demand.
+//
+//     lazy_parse [SCRIPT]
+//
+// SCRIPT defaults to bench/corpus/functions.rad, repeated to each size.
+
+#include "bench.h"
+
+#include "tree-sitter-rad-util.h"
+
+enum Mode
+{
+    FULL,
+    LAZY,
+    BODY,
+};
+
+static const char *const MODE_NAMES[] = {"full", "lazy", "body"};
+
+typedef struct
+{
+    TSParser *parser;
+    const char *source;
+    uint32_t length;
+    enum Mode mode;
+    const TSRadLazyTree *lazy;
+    uint32_t body;
+} Parse;
+
+static void run_parse(void *payload)
+{
+    const Parse *parse = payload;
+    switch (parse->mode)
+    {
+    case FULL:
+        ts_tree_delete(ts_parser_parse_string(parse->parser, NULL, parse->source, parse->length));
+        break;
+    case LAZY:
+        tree_sitter_rad_lazy_tree_delete(tree_sitter_rad_parse_lazy(parse->parser, parse->source, parse->length));
+        break;
+    case BODY:
+        ts_tree_delete(tree_sitter_rad_parse_body(parse->parser, parse->lazy, parse->body));
+        break;
+    }
+}
+
+static uint64_t time_parse(TSParser *parser, const char *source, uint32_t length, enum Mode mode)
+{
+    TSRadLazyTree *lazy = mode == BODY ? tree_sitter_rad_parse_lazy(parser, source, length) : NULL;
+    uint32_t count = 0;
+    if (lazy != NULL)
+    {
+        tree_sitter_rad_lazy_tree_bodies(lazy, &count);
+    }
+
+    // BODY parses the body in the middle, which a full reparse would reach
+    // last.
+    Parse parse = {parser, source, length, mode, lazy, count / 2};
+    uint64_t ns = bench_time_until(BENCH_MIN_RUN_NS, run_parse, &parse);
+
+    if (lazy != NULL)
+    {
+        tree_sitter_rad_lazy_tree_delete(lazy);
+    }
+    return ns;
+}
+
+int main(int argc, char **argv)
+{
+    const char *script = argc > 1 ? argv[1] : "bench/corpus/functions.rad";
+
+    TSParser *parser = bench_new_parser();
+    for (uint32_t size = 4 << 10; size <= 16u << 20; size <<= 2)
+    {
+        uint32_t length;
+        char *source = bench_repeat_file(script, size, &length);
+
+        TSRadLazyTree *lazy = tree_sitter_rad_parse_lazy(parser, source, length);
+        uint32_t bodies;
+        tree_sitter_rad_lazy_tree_bodies(lazy, &bodies);
+        tree_sitter_rad_lazy_tree_delete(lazy);
+
+        for (enum Mode mode = FULL; mode <= BODY; mode++)
+        {
+            uint64_t ns = time_parse(parser, source, length, mode);
+            printf("{\"bench\":\"lazy_parse\",\"mode\":\"%s\",\"bytes\":%u,\"bodies\":%u,\"ns_per_parse\":%llu,"
+                   "\"mb_per_s\":%.2f}\n",
+                   MODE_NAMES[mode], length, bodies, (unsigned long long)ns, (double)length * 1e3 / (double)ns);
+        }
+        free(source);
+    }
+    ts_parser_delete(parser);
+    return 0;
+}
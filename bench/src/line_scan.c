@@ -0,0 +1,68 @@
+// Times tree_sitter_rad_scan_lines with each byte-classifying kernel this
+// machine supports, after checking that each finds the same lines as the
+// scalar one.
+//
+//     line_scan [SCRIPT [MIB]]
+//
+// SCRIPT defaults to bench/corpus/functions.rad, repeated to MIB MiB (64 by
+// default). Exits with status 1 if a kernel's lines differ.
+
+#include "bench.h"
+
+#include <string.h>
+
+#include "tree-sitter-rad-util.h"
+
+static const char *const KERNEL_NAMES[] = {"best", "scalar", "sse2", "avx2"};
+
+typedef struct
+{
+    const char *source;
+    uint32_t length;
+    TSRadScanKernel kernel;
+    TSRadLine *lines;
+    uint32_t count;
+} Scan;
+
+static void run_scan(void *payload)
+{
+    const Scan *scan = payload;
+    tree_sitter_rad_scan_lines(scan->source, scan->length, scan->kernel, scan->lines, scan->count);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t size = (argc > 2 ? (uint32_t)atoi(argv[2]) : 64) << 20;
+    uint32_t length;
+    char *source = bench_repeat_file(argc > 1 ? argv[1] : "bench/corpus/functions.rad", size, &length);
+
+    uint32_t count = tree_sitter_rad_scan_lines(source, length, TSRadScanKernelScalar, NULL, 0);
+    TSRadLine *expected = malloc(count * sizeof(TSRadLine));
+    TSRadLine *lines = malloc(count * sizeof(TSRadLine));
+    tree_sitter_rad_scan_lines(source, length, TSRadScanKernelScalar, expected, count);
+
+    for (TSRadScanKernel kernel = TSRadScanKernelScalar; kernel <= TSRadScanKernelAVX2; kernel++)
+    {
+        if (!tree_sitter_rad_scan_kernel_supported(kernel))
+        {
+            continue;
+        }
+        if (tree_sitter_rad_scan_lines(source, length, kernel, lines, count) != count ||
+            memcmp(lines, expected, count * sizeof(TSRadLine)) != 0)
+        {
+            fprintf(stderr, "%s: lines differ from the scalar kernel's\n", KERNEL_NAMES[kernel]);
+            return 1;
+        }
+
+        Scan scan = {source, length, kernel, lines, count};
+        uint64_t ns = bench_time_until(BENCH_MIN_RUN_NS, run_scan, &scan);
+        printf("{\"bench\":\"line_scan\",\"kernel\":\"%s\",\"bytes\":%u,\"lines\":%u,\"ns_per_scan\":%llu,"
+               "\"gb_per_s\":%.2f}\n",
+               KERNEL_NAMES[kernel], length, count, (unsigned long long)ns, (double)length / (double)ns);
+    }
+
+    free(lines);
+    free(expected);
+    free(source);
+    return 0;
+}
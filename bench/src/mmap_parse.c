@@ -0,0 +1,102 @@
+// Compares parsing a file through tree_sitter_rad_parse_file's mapping with
+// the usual read-into-a-buffer-then-parse.
+//
+//     mmap_parse read|mmap FILE [ITERATIONS]
+//
+// Run each mode in its own process: peak RSS only ever grows.
+
+#include "bench.h"
+
+#include <string.h>
+
+#include "tree-sitter-rad-util.h"
+
+// Resident anonymous (heap) memory in KiB, or -1 where /proc isn't available.
+// Mapped source pages are file-backed and clean, so unlike a heap copy they
+// don't show up here and the kernel can drop them under pressure.
+static long rss_anon_kib(void)
+{
+    FILE *status = fopen("/proc/self/status", "r");
+    if (status == NULL)
+    {
+        return -1;
+    }
+    char line[256];
+    long kib = -1;
+    while (fgets(line, sizeof(line), status) != NULL)
+    {
+        if (sscanf(line, "RssAnon: %ld kB", &kib) == 1)
+        {
+            break;
+        }
+    }
+    fclose(status);
+    return kib;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3 || (strcmp(argv[1], "read") != 0 && strcmp(argv[1], "mmap") != 0))
+    {
+        fprintf(stderr, "usage: %s read|mmap FILE [ITERATIONS]\n", argv[0]);
+        return 2;
+    }
+    int mapped = strcmp(argv[1], "mmap") == 0;
+    const char *path = argv[2];
+    int iterations = argc > 3 ? atoi(argv[3]) : 10;
+    if (iterations < 1)
+    {
+        iterations = 1;
+    }
+
+    TSParser *parser = bench_new_parser();
+    uint64_t bytes = 0, nodes = 0, elapsed = 0;
+    long anon_kib = -1;
+    for (int i = 0; i < iterations; i++)
+    {
+        uint64_t start = bench_now_ns();
+        TSRadMappedFile file;
+        char *buffer = NULL;
+        uint32_t length;
+        TSTree *tree;
+        if (mapped)
+        {
+            int error;
+            tree = tree_sitter_rad_parse_file(parser, path, &file, &error);
+            if (tree == NULL)
+            {
+                fprintf(stderr, "%s: %s\n", path, strerror(error));
+                return 1;
+            }
+            length = (uint32_t)file.length;
+        }
+        else
+        {
+            buffer = bench_read_file(path, &length);
+            tree = ts_parser_parse_string(parser, NULL, buffer, length);
+        }
+        elapsed += bench_now_ns() - start;
+
+        // Sample while both the source and the tree are live, which is where
+        // an embedder's footprint peaks.
+        anon_kib = rss_anon_kib();
+        bytes += length;
+        nodes += ts_node_descendant_count(ts_tree_root_node(tree));
+        ts_tree_delete(tree);
+        if (mapped)
+        {
+            tree_sitter_rad_unmap_file(&file);
+        }
+        free(buffer);
+    }
+    ts_parser_delete(parser);
+
+    double seconds = (double)elapsed / 1e9;
+    printf("{\"bench\":\"mmap_parse\",\"mode\":\"%s\",\"file\":\"%s\",\"bytes\":%llu,"
+           "\"iterations\":%d,\"ns_per_parse\":%.0f,\"mb_per_s\":%.2f,\"nodes_per_s\":%.0f,"
+           "\"peak_rss_kib\":%ld,\"rss_anon_kib\":%ld}\n",
+           argv[1], path, (unsigned long long)(bytes / (uint64_t)iterations), iterations,
+           (double)elapsed / iterations, (double)bytes / 1e6 / seconds, (double)nodes / seconds,
+           bench_peak_rss_kib(), anon_kib);
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Parses a script piped in from another process, reporting how long it
+// takes until the first statement's tree is available, the total time, and
+// peak memory.
+//
+//     stream_parse MODE [SCRIPT [MIB [MIB_PER_S]]]
+//
+// MODE is one of:
+//   buffered    read the whole pipe into a buffer, then parse it
+//   input       parse once through tree_sitter_rad_stream_input
+//   statements  parse with tree_sitter_rad_stream_parse_next, releasing the
+//               input behind each tree
+//
+// SCRIPT defaults to bench/corpus/functions.rad, repeated to MIB MiB (32 by
+// default) by a writer process, at MIB_PER_S MiB/s or as fast as the pipe
+// takes it if 0 (the default). Peak memory is the reader's alone.
+
+#include "bench.h"
+
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "tree-sitter-rad-util.h"
+
+static void write_script(int fd, const char *unit, uint32_t unit_length, uint32_t copies, uint32_t mib_per_s)
+{
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < copies; i++)
+    {
+        for (uint32_t written = 0; written < unit_length;)
+        {
+            ssize_t count = write(fd, unit + written, unit_length - written);
+            if (count < 0)
+            {
+                perror("write");
+                _exit(1);
+            }
+            written += (uint32_t)count;
+        }
+        if (mib_per_s > 0)
+        {
+            uint64_t due = start + (uint64_t)(i + 1) * unit_length * 1000000000ull / ((uint64_t)mib_per_s << 20);
+            uint64_t now = bench_now_ns();
+            if (due > now)
+            {
+                struct timespec wait = {(time_t)((due - now) / 1000000000u), (long)((due - now) % 1000000000u)};
+                nanosleep(&wait, NULL);
+            }
+        }
+    }
+    close(fd);
+}
+
+static char *read_all(int fd, uint32_t *length)
+{
+    size_t capacity = 64 * 1024, size = 0;
+    char *data = malloc(capacity);
+    for (;;)
+    {
+        if (size == capacity)
+        {
+            capacity *= 2;
+            data = realloc(data, capacity);
+        }
+        ssize_t count = read(fd, data + size, capacity - size);
+        if (count <= 0)
+        {
+            break;
+        }
+        size += (size_t)count;
+    }
+    *length = (uint32_t)size;
+    return data;
+}
+
+int main(int argc, char **argv)
+{
+    const char *mode = argc > 1 ? argv[1] : "statements";
+    uint32_t unit_length;
+    char *unit = bench_read_file(argc > 2 ? argv[2] : "bench/corpus/functions.rad", &unit_length);
+    uint32_t size = (argc > 3 ? (uint32_t)atoi(argv[3]) : 32) << 20;
+    uint32_t mib_per_s = argc > 4 ? (uint32_t)atoi(argv[4]) : 0;
+    uint32_t copies = (size + unit_length - 1) / unit_length;
+    uint32_t length = copies * unit_length;
+    // A tree ending past this holds a statement.
+    uint32_t preamble = tree_sitter_rad_preamble_length(unit, unit_length);
+
+    TSParser *parser = bench_new_parser();
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        perror("pipe");
+        return 1;
+    }
+    uint64_t start = bench_now_ns();
+    pid_t writer = fork();
+    if (writer == 0)
+    {
+        close(fds[0]);
+        write_script(fds[1], unit, unit_length, copies, mib_per_s);
+        _exit(0);
+    }
+    close(fds[1]);
+
+    uint64_t first_statement = 0;
+    uint32_t parts = 1, read_length = 0;
+    if (strcmp(mode, "buffered") == 0)
+    {
+        char *source = read_all(fds[0], &read_length);
+        TSTree *tree = ts_parser_parse_string(parser, NULL, source, read_length);
+        first_statement = bench_now_ns();
+        ts_tree_delete(tree);
+        free(source);
+    }
+    else if (strcmp(mode, "input") == 0)
+    {
+        TSRadStream *stream = tree_sitter_rad_stream_new(fds[0], 0);
+        TSTree *tree = ts_parser_parse(parser, NULL, tree_sitter_rad_stream_input(stream));
+        first_statement = bench_now_ns();
+        tree_sitter_rad_stream_text(stream, 0, &read_length);
+        ts_tree_delete(tree);
+        tree_sitter_rad_stream_delete(stream);
+    }
+    else if (strcmp(mode, "statements") == 0)
+    {
+        TSRadStream *stream = tree_sitter_rad_stream_new(fds[0], 0);
+        TSTree *tree;
+        uint32_t end = 0, rest;
+        for (parts = 0; (tree = tree_sitter_rad_stream_parse_next(stream, parser)) != NULL; parts++)
+        {
+            end = ts_node_end_byte(ts_tree_root_node(tree));
+            if (first_statement == 0 && end > preamble)
+            {
+                first_statement = bench_now_ns();
+            }
+            tree_sitter_rad_stream_release(stream, end);
+            ts_tree_delete(tree);
+        }
+        tree_sitter_rad_stream_text(stream, end, &rest);
+        read_length = end + rest;
+        tree_sitter_rad_stream_delete(stream);
+    }
+    else
+    {
+        fprintf(stderr, "unknown mode %s\n", mode);
+        return 1;
+    }
+    uint64_t total = bench_now_ns() - start;
+    close(fds[0]);
+    waitpid(writer, NULL, 0);
+    if (read_length != length)
+    {
+        fprintf(stderr, "%s: parsed %u bytes, expected %u\n", mode, read_length, length);
+        return 1;
+    }
+
+    printf("{\"bench\":\"stream_parse\",\"mode\":\"%s\",\"bytes\":%u,\"mib_per_s_in\":%u,\"parts\":%u,"
+           "\"first_statement_ms\":%.2f,\"total_ms\":%.2f,\"mb_per_s\":%.2f,\"peak_rss_kib\":%ld}\n",
+           mode, length, mib_per_s, parts, (double)(first_statement - start) / 1e6, (double)total / 1e6,
+           (double)length * 1e3 / (double)total, bench_peak_rss_kib());
+
+    ts_parser_delete(parser);
+    free(unit);
+    return 0;
+}
@@ -0,0 +1,480 @@
+// Code generated by bindings/go/gen_symbols_test.go; DO NOT EDIT.
+
+#ifndef TREE_SITTER_RAD_SYMBOLS_H_
+#define TREE_SITTER_RAD_SYMBOLS_H_
+
+#define TS_RAD_LANGUAGE_VERSION 14
+#define TS_RAD_STATE_COUNT 4214
+#define TS_RAD_SYMBOL_COUNT 329
+#define TS_RAD_FIELD_COUNT 106
+#define TS_RAD_SYMBOL_HASH 0x3e56705523c0c575ULL
+
+enum ts_rad_symbol {
+    TS_RAD_SYM_END = 0,
+    TS_RAD_SYM_IDENTIFIERREGEX = 1,
+    TS_RAD_SYM_SHEBANG = 2,
+    TS_RAD_AUX_SYM_FILE_HEADER_CONTENTS_TOKEN1 = 3,
+    TS_RAD_AUX_SYM_FILE_HEADER_CONTENTS_TOKEN2 = 4,
+    TS_RAD_ANON_SYM_DASH_DASH_DASH = 5,
+    TS_RAD_ANON_SYM_QMARK = 6,
+    TS_RAD_ANON_SYM_COLON = 7,
+    TS_RAD_ANON_SYM_OR = 8,
+    TS_RAD_ANON_SYM_AND = 9,
+    TS_RAD_ANON_SYM_LT = 10,
+    TS_RAD_ANON_SYM_LT_EQ = 11,
+    TS_RAD_ANON_SYM_EQ_EQ = 12,
+    TS_RAD_ANON_SYM_BANG_EQ = 13,
+    TS_RAD_ANON_SYM_GT_EQ = 14,
+    TS_RAD_ANON_SYM_GT = 15,
+    TS_RAD_ANON_SYM_IN = 16,
+    TS_RAD_ANON_SYM_NOT = 17,
+    TS_RAD_ANON_SYM_STAR = 18,
+    TS_RAD_ANON_SYM_SLASH = 19,
+    TS_RAD_ANON_SYM_PERCENT = 20,
+    TS_RAD_ANON_SYM_QMARK_QMARK = 21,
+    TS_RAD_ANON_SYM_CATCH = 22,
+    TS_RAD_ANON_SYM_LPAREN = 23,
+    TS_RAD_ANON_SYM_RPAREN = 24,
+    TS_RAD_ANON_SYM_COMMA = 25,
+    TS_RAD_ANON_SYM_EQ = 26,
+    TS_RAD_ANON_SYM_PLUS = 27,
+    TS_RAD_ANON_SYM_DASH = 28,
+    TS_RAD_ANON_SYM_PLUS_EQ = 29,
+    TS_RAD_ANON_SYM_DASH_EQ = 30,
+    TS_RAD_ANON_SYM_STAR_EQ = 31,
+    TS_RAD_ANON_SYM_SLASH_EQ = 32,
+    TS_RAD_ANON_SYM_PERCENT_EQ = 33,
+    TS_RAD_ANON_SYM_PLUS_PLUS = 34,
+    TS_RAD_ANON_SYM_DASH_DASH = 35,
+    TS_RAD_ANON_SYM_LBRACK = 36,
+    TS_RAD_ANON_SYM_RBRACK = 37,
+    TS_RAD_ANON_SYM_DOT = 38,
+    TS_RAD_ANON_SYM_JSON = 39,
+    TS_RAD_ANON_SYM_DEL = 40,
+    TS_RAD_SYM_BREAK_STMT = 41,
+    TS_RAD_SYM_CONTINUE_STMT = 42,
+    TS_RAD_SYM_PASS_STMT = 43,
+    TS_RAD_ANON_SYM_ELSE = 44,
+    TS_RAD_ANON_SYM_IF = 45,
+    TS_RAD_ANON_SYM_WHILE = 46,
+    TS_RAD_ANON_SYM_FOR = 47,
+    TS_RAD_ANON_SYM_WITH = 48,
+    TS_RAD_ANON_SYM_SWITCH = 49,
+    TS_RAD_ANON_SYM_CASE = 50,
+    TS_RAD_ANON_SYM_DASH_GT = 51,
+    TS_RAD_ANON_SYM_YIELD = 52,
+    TS_RAD_ANON_SYM_DEFAULT = 53,
+    TS_RAD_ANON_SYM_QUIET = 54,
+    TS_RAD_ANON_SYM_CONFIRM = 55,
+    TS_RAD_ANON_SYM_DOLLAR = 56,
+    TS_RAD_ANON_SYM_ARGS = 57,
+    TS_RAD_AUX_SYM__ARG_COMMENT_TOKEN1 = 58,
+    TS_RAD_SYM_COMMENT_TEXT = 59,
+    TS_RAD_SYM_SHORTHAND_FLAG = 60,
+    TS_RAD_ANON_SYM_ENUM = 61,
+    TS_RAD_ANON_SYM_REGEX = 62,
+    TS_RAD_ANON_SYM_RANGE = 63,
+    TS_RAD_ANON_SYM_LEN = 64,
+    TS_RAD_ANON_SYM_MUTUALLY = 65,
+    TS_RAD_ANON_SYM_REQUIRES = 66,
+    TS_RAD_ANON_SYM_EXCLUDES = 67,
+    TS_RAD_ANON_SYM_COMMAND = 68,
+    TS_RAD_ANON_SYM_CALLS = 69,
+    TS_RAD_ANON_SYM_RAD = 70,
+    TS_RAD_ANON_SYM_REQUEST = 71,
+    TS_RAD_ANON_SYM_DISPLAY = 72,
+    TS_RAD_ANON_SYM_INSECURE = 73,
+    TS_RAD_ANON_SYM_NOPRINT = 74,
+    TS_RAD_ANON_SYM_TRANSPOSE = 75,
+    TS_RAD_ANON_SYM_SORT = 76,
+    TS_RAD_AUX_SYM_RAD_SORT_SPECIFIER_TOKEN1 = 77,
+    TS_RAD_ANON_SYM_ASC = 78,
+    TS_RAD_ANON_SYM_DESC = 79,
+    TS_RAD_SYM_IMMEDIATE_IDENTIFIER = 80,
+    TS_RAD_ANON_SYM_FIELDS = 81,
+    TS_RAD_ANON_SYM_COLOR = 82,
+    TS_RAD_ANON_SYM_MAP = 83,
+    TS_RAD_ANON_SYM_FILTER = 84,
+    TS_RAD_ANON_SYM_DEFER = 85,
+    TS_RAD_ANON_SYM_ERRDEFER = 86,
+    TS_RAD_ANON_SYM_FN = 87,
+    TS_RAD_ANON_SYM_PIPE = 88,
+    TS_RAD_ANON_SYM_LBRACK_RBRACK = 89,
+    TS_RAD_ANON_SYM_RETURN = 90,
+    TS_RAD_SYM_COMMENT = 91,
+    TS_RAD_SYM_STRING_TYPE = 92,
+    TS_RAD_SYM_INT_TYPE = 93,
+    TS_RAD_SYM_FLOAT_TYPE = 94,
+    TS_RAD_SYM_BOOL_TYPE = 95,
+    TS_RAD_SYM_STRING_LIST_TYPE = 96,
+    TS_RAD_SYM_INT_LIST_TYPE = 97,
+    TS_RAD_SYM_FLOAT_LIST_TYPE = 98,
+    TS_RAD_SYM_BOOL_LIST_TYPE = 99,
+    TS_RAD_ANON_SYM_LIST = 100,
+    TS_RAD_SYM_ERROR_TYPE = 101,
+    TS_RAD_SYM_VOID_TYPE = 102,
+    TS_RAD_SYM_ANY_TYPE = 103,
+    TS_RAD_ANON_SYM_LBRACE = 104,
+    TS_RAD_ANON_SYM_RBRACE = 105,
+    TS_RAD_SYM_ESC_SINGLE_QUOTE = 106,
+    TS_RAD_SYM_ESC_DOUBLE_QUOTE = 107,
+    TS_RAD_SYM_ESC_BACKTICK = 108,
+    TS_RAD_SYM_ESC_NEWLINE = 109,
+    TS_RAD_SYM_ESC_TAB = 110,
+    TS_RAD_SYM_ESC_BACKSLASH = 111,
+    TS_RAD_SYM_ESC_OPEN_BRACKET = 112,
+    TS_RAD_SYM_ESC_CLOSE_BRACKET = 113,
+    TS_RAD_ANON_SYM_BSLASH = 114,
+    TS_RAD_SYM_FILL_ALIGNMENT = 115,
+    TS_RAD_ANON_SYM_UNSAFE = 116,
+    TS_RAD_SYM_INT = 117,
+    TS_RAD_SYM_FLOAT = 118,
+    TS_RAD_SYM_SCIENTIFIC_NUMBER = 119,
+    TS_RAD_ANON_SYM_TRUE = 120,
+    TS_RAD_ANON_SYM_FALSE = 121,
+    TS_RAD_SYM_NULL = 122,
+    TS_RAD_SYM__NEWLINE = 123,
+    TS_RAD_SYM__INDENT = 124,
+    TS_RAD_SYM__DEDENT = 125,
+    TS_RAD_SYM_STRING_START = 126,
+    TS_RAD_SYM_STRING_CONTENT = 127,
+    TS_RAD_SYM_STRING_END = 128,
+    TS_RAD_SYM__BLOCK_COLON = 129,
+    TS_RAD_SYM_SOURCE_FILE = 130,
+    TS_RAD_SYM_FILE_HEADER = 131,
+    TS_RAD_SYM_FILE_HEADER_CONTENTS = 132,
+    TS_RAD_SYM__FILE_HEADER_LINE = 133,
+    TS_RAD_SYM__STMT = 134,
+    TS_RAD_SYM__SIMPLE_STMTS = 135,
+    TS_RAD_SYM__SIMPLE_STMT = 136,
+    TS_RAD_SYM_EXPR_STMT = 137,
+    TS_RAD_SYM__LAMBDA_COMPAT_STMT = 138,
+    TS_RAD_SYM_EXPR = 139,
+    TS_RAD_SYM_TERNARY_EXPR = 140,
+    TS_RAD_SYM_OR_EXPR = 141,
+    TS_RAD_SYM_AND_EXPR = 142,
+    TS_RAD_SYM_COMPARE_EXPR = 143,
+    TS_RAD_SYM_NOT_IN = 144,
+    TS_RAD_SYM_ADD_EXPR = 145,
+    TS_RAD_SYM_MULT_EXPR = 146,
+    TS_RAD_SYM_UNARY_EXPR = 147,
+    TS_RAD_SYM_FALLBACK_EXPR = 148,
+    TS_RAD_SYM_CATCH_EXPR = 149,
+    TS_RAD_SYM__SIGNED_OPERAND = 150,
+    TS_RAD_SYM__SIGNED_POSTFIX = 151,
+    TS_RAD_SYM__POSTFIX_EXPR = 152,
+    TS_RAD_SYM_INDEXED_EXPR = 153,
+    TS_RAD_SYM_PRIMARY_EXPR = 154,
+    TS_RAD_SYM_PARENTHESIZED_EXPR = 155,
+    TS_RAD_SYM_CALL = 156,
+    TS_RAD_SYM__CALL_ARG_LIST = 157,
+    TS_RAD_SYM_CALL_NAMED_ARG = 158,
+    TS_RAD_SYM__UNARY_OP_SIGN = 159,
+    TS_RAD_SYM_ASSIGN = 160,
+    TS_RAD_SYM_TYPED_ASSIGN = 161,
+    TS_RAD_SYM_CATCH_BLOCK = 162,
+    TS_RAD_SYM_COMPOUND_ASSIGN = 163,
+    TS_RAD_SYM_INCR_DECR = 164,
+    TS_RAD_SYM__LEFT_SIDE_SINGLE = 165,
+    TS_RAD_SYM__LEFT_SIDE = 166,
+    TS_RAD_SYM__RIGHT_SIDE_SINGLE = 167,
+    TS_RAD_SYM__RIGHT_SIDE = 168,
+    TS_RAD_SYM_VAR_PATH = 169,
+    TS_RAD_SYM_INCR_DECR_LEFT = 170,
+    TS_RAD_SYM__INDEXING = 171,
+    TS_RAD_SYM_SLICE = 172,
+    TS_RAD_SYM_JSON_PATH = 173,
+    TS_RAD_SYM_JSON_OPENER = 174,
+    TS_RAD_SYM_JSON_SEGMENT = 175,
+    TS_RAD_SYM_JSON_PATH_INDEXER = 176,
+    TS_RAD_SYM_DEL_STMT = 177,
+    TS_RAD_SYM__COMPLEX_STMT = 178,
+    TS_RAD_SYM_IF_STMT = 179,
+    TS_RAD_SYM_IF_ALT = 180,
+    TS_RAD_SYM__IF_CLAUSE = 181,
+    TS_RAD_SYM_ELSE_ALT = 182,
+    TS_RAD_SYM_FOR_LOOP = 183,
+    TS_RAD_SYM_WHILE_LOOP = 184,
+    TS_RAD_SYM__FOR_IN = 185,
+    TS_RAD_SYM_FOR_LEFTS = 186,
+    TS_RAD_SYM_LIST_COMPREHENSION = 187,
+    TS_RAD_SYM_SWITCH_STMT = 188,
+    TS_RAD_SYM_SWITCH_CASE = 189,
+    TS_RAD_SYM__SWITCH_CASE_VALUE_ALT = 190,
+    TS_RAD_SYM_SWITCH_CASE_EXPR = 191,
+    TS_RAD_SYM_SWITCH_CASE_BLOCK = 192,
+    TS_RAD_SYM_YIELD_STMT = 193,
+    TS_RAD_SYM_SWITCH_DEFAULT = 194,
+    TS_RAD_SYM__SHELL_OPERAND = 195,
+    TS_RAD_SYM_SHELL_CMD = 196,
+    TS_RAD_SYM_ARG_BLOCK = 197,
+    TS_RAD_SYM__ARG_STMT = 198,
+    TS_RAD_SYM_ARG_DECLARATION = 199,
+    TS_RAD_SYM__VARIADIC_ARG_DECLARATION = 200,
+    TS_RAD_SYM__NON_VARIADIC_ARG_DECLARATION = 201,
+    TS_RAD_SYM__ARG_COMMENT = 202,
+    TS_RAD_SYM__TYPE_ANDOR_DEFAULT = 203,
+    TS_RAD_SYM__VARIADIC_TYPE_ANDOR_DEFAULT = 204,
+    TS_RAD_SYM__ARG_STRING_DEFAULT = 205,
+    TS_RAD_SYM__ARG_INT_DEFAULT = 206,
+    TS_RAD_SYM__ARG_FLOAT_DEFAULT = 207,
+    TS_RAD_SYM__ARG_BOOL_DEFAULT = 208,
+    TS_RAD_SYM__ARG_STRING_LIST_DEFAULT = 209,
+    TS_RAD_SYM__ARG_INT_LIST_DEFAULT = 210,
+    TS_RAD_SYM__ARG_FLOAT_LIST_DEFAULT = 211,
+    TS_RAD_SYM__ARG_BOOL_LIST_DEFAULT = 212,
+    TS_RAD_SYM__ARG_STRING_VAR_DEFAULT = 213,
+    TS_RAD_SYM__ARG_INT_VAR_DEFAULT = 214,
+    TS_RAD_SYM__ARG_FLOAT_VAR_DEFAULT = 215,
+    TS_RAD_SYM__ARG_BOOL_VAR_DEFAULT = 216,
+    TS_RAD_SYM_INT_ARG = 217,
+    TS_RAD_SYM_FLOAT_ARG = 218,
+    TS_RAD_SYM__ARG_CONSTRAINT = 219,
+    TS_RAD_SYM_ARG_ENUM_CONSTRAINT = 220,
+    TS_RAD_SYM_ARG_REGEX_CONSTRAINT = 221,
+    TS_RAD_SYM_ARG_RANGE_CONSTRAINT = 222,
+    TS_RAD_SYM__ARG_RANGE_CONSTRAINT_MIN_ONLY = 223,
+    TS_RAD_SYM__ARG_RANGE_CONSTRAINT_MAX_ONLY = 224,
+    TS_RAD_SYM__ARG_RANGE_CONSTRAINT_MIN_MAX = 225,
+    TS_RAD_SYM__ARG_RANGE_CONSTRAINT_MIN = 226,
+    TS_RAD_SYM__ARG_RANGE_CONSTRAINT_MAX = 227,
+    TS_RAD_SYM_ARG_LEN_CONSTRAINT = 228,
+    TS_RAD_SYM__ARG_LEN_CONSTRAINT_MIN_ONLY = 229,
+    TS_RAD_SYM__ARG_LEN_CONSTRAINT_MAX_ONLY = 230,
+    TS_RAD_SYM__ARG_LEN_CONSTRAINT_MIN_MAX = 231,
+    TS_RAD_SYM_ARG_REQUIRES_CONSTRAINT = 232,
+    TS_RAD_SYM_ARG_EXCLUDES_CONSTRAINT = 233,
+    TS_RAD_SYM_CMD_BLOCK = 234,
+    TS_RAD_SYM_CMD_DESCRIPTION = 235,
+    TS_RAD_SYM_CMD_DESCRIPTION_CONTENTS = 236,
+    TS_RAD_SYM_CMD_CALLS = 237,
+    TS_RAD_SYM_RAD_BLOCK = 238,
+    TS_RAD_SYM_RAD_KEYWORD = 239,
+    TS_RAD_SYM__RAD_STMT = 240,
+    TS_RAD_SYM__RAD_SIMPLE_STMTS = 241,
+    TS_RAD_SYM_RAD_OPTION_STMT = 242,
+    TS_RAD_SYM_RAD_OPTION_KEYWORD = 243,
+    TS_RAD_SYM_RAD_SORT_STMT = 244,
+    TS_RAD_SYM_RAD_SORT_SPECIFIER = 245,
+    TS_RAD_SYM_RAD_FIELD_STMT = 246,
+    TS_RAD_SYM_RAD_FIELD_MODIFIER_STMT = 247,
+    TS_RAD_SYM__RAD_FIELD_MODIFIER = 248,
+    TS_RAD_SYM_RAD_FIELD_MOD_COLOR = 249,
+    TS_RAD_SYM_RAD_FIELD_MOD_MAP = 250,
+    TS_RAD_SYM_RAD_FIELD_MOD_FILTER = 251,
+    TS_RAD_SYM_RAD_IF_STMT = 252,
+    TS_RAD_SYM_RAD_IF_ALT = 253,
+    TS_RAD_SYM_RAD_ELSE_ALT = 254,
+    TS_RAD_SYM_DEFER_BLOCK = 255,
+    TS_RAD_SYM_FN_NAMED = 256,
+    TS_RAD_SYM_FN_LAMBDA = 257,
+    TS_RAD_SYM__FN_BODY = 258,
+    TS_RAD_SYM__FN_BLOCK = 259,
+    TS_RAD_SYM__FN_PARAM_LIST = 260,
+    TS_RAD_SYM__POSITIONAL_PARAMS = 261,
+    TS_RAD_SYM_NORMAL_PARAM = 262,
+    TS_RAD_SYM_VARARG_PARAM = 263,
+    TS_RAD_SYM_FN_PARAM_OR_RETURN_TYPE = 264,
+    TS_RAD_SYM_FN_LEAF_TYPE = 265,
+    TS_RAD_SYM_RETURN_STMT = 266,
+    TS_RAD_SYM_LIST_TYPE = 267,
+    TS_RAD_SYM_FN_TYPE = 268,
+    TS_RAD_SYM_MAP_TYPE = 269,
+    TS_RAD_SYM_NAMED_MAP_ENTRY = 270,
+    TS_RAD_SYM_EMPTY_LIST = 271,
+    TS_RAD_SYM_STRING_LIST = 272,
+    TS_RAD_SYM_INT_LIST = 273,
+    TS_RAD_SYM_FLOAT_LIST = 274,
+    TS_RAD_SYM_BOOL_LIST = 275,
+    TS_RAD_SYM_LIST = 276,
+    TS_RAD_SYM_MAP = 277,
+    TS_RAD_SYM_MAP_ENTRY = 278,
+    TS_RAD_SYM_STRING = 279,
+    TS_RAD_SYM_STRING_CONTENTS = 280,
+    TS_RAD_SYM__ESCAPE_SEQ = 281,
+    TS_RAD_SYM__NOT_ESCAPE_SEQ = 282,
+    TS_RAD_SYM_INTERPOLATION = 283,
+    TS_RAD_SYM_FORMAT_SPECIFIER = 284,
+    TS_RAD_SYM__IDENTIFIER = 285,
+    TS_RAD_SYM_BOOL = 286,
+    TS_RAD_SYM_LITERAL = 287,
+    TS_RAD_AUX_SYM_SOURCE_FILE_REPEAT1 = 288,
+    TS_RAD_AUX_SYM_SOURCE_FILE_REPEAT2 = 289,
+    TS_RAD_AUX_SYM_FILE_HEADER_CONTENTS_REPEAT1 = 290,
+    TS_RAD_AUX_SYM_INDEXED_EXPR_REPEAT1 = 291,
+    TS_RAD_AUX_SYM__CALL_ARG_LIST_REPEAT1 = 292,
+    TS_RAD_AUX_SYM__CALL_ARG_LIST_REPEAT2 = 293,
+    TS_RAD_AUX_SYM__LEFT_SIDE_REPEAT1 = 294,
+    TS_RAD_AUX_SYM__RIGHT_SIDE_REPEAT1 = 295,
+    TS_RAD_AUX_SYM_JSON_PATH_REPEAT1 = 296,
+    TS_RAD_AUX_SYM_JSON_OPENER_REPEAT1 = 297,
+    TS_RAD_AUX_SYM_DEL_STMT_REPEAT1 = 298,
+    TS_RAD_AUX_SYM_IF_STMT_REPEAT1 = 299,
+    TS_RAD_AUX_SYM_FOR_LEFTS_REPEAT1 = 300,
+    TS_RAD_AUX_SYM_SWITCH_STMT_REPEAT1 = 301,
+    TS_RAD_AUX_SYM_SWITCH_CASE_REPEAT1 = 302,
+    TS_RAD_AUX_SYM_SHELL_CMD_REPEAT1 = 303,
+    TS_RAD_AUX_SYM_ARG_BLOCK_REPEAT1 = 304,
+    TS_RAD_AUX_SYM_INT_ARG_REPEAT1 = 305,
+    TS_RAD_AUX_SYM_ARG_REQUIRES_CONSTRAINT_REPEAT1 = 306,
+    TS_RAD_AUX_SYM_ARG_EXCLUDES_CONSTRAINT_REPEAT1 = 307,
+    TS_RAD_AUX_SYM_CMD_BLOCK_REPEAT1 = 308,
+    TS_RAD_AUX_SYM_RAD_BLOCK_REPEAT1 = 309,
+    TS_RAD_AUX_SYM_RAD_SORT_STMT_REPEAT1 = 310,
+    TS_RAD_AUX_SYM_RAD_FIELD_STMT_REPEAT1 = 311,
+    TS_RAD_AUX_SYM_RAD_FIELD_MODIFIER_STMT_REPEAT1 = 312,
+    TS_RAD_AUX_SYM_RAD_IF_STMT_REPEAT1 = 313,
+    TS_RAD_AUX_SYM__FN_PARAM_LIST_REPEAT1 = 314,
+    TS_RAD_AUX_SYM__POSITIONAL_PARAMS_REPEAT1 = 315,
+    TS_RAD_AUX_SYM_FN_PARAM_OR_RETURN_TYPE_REPEAT1 = 316,
+    TS_RAD_AUX_SYM_FN_LEAF_TYPE_REPEAT1 = 317,
+    TS_RAD_AUX_SYM_LIST_TYPE_REPEAT1 = 318,
+    TS_RAD_AUX_SYM_LIST_TYPE_REPEAT2 = 319,
+    TS_RAD_AUX_SYM_FN_TYPE_REPEAT1 = 320,
+    TS_RAD_AUX_SYM_MAP_TYPE_REPEAT1 = 321,
+    TS_RAD_AUX_SYM_STRING_LIST_REPEAT1 = 322,
+    TS_RAD_AUX_SYM_INT_LIST_REPEAT1 = 323,
+    TS_RAD_AUX_SYM_FLOAT_LIST_REPEAT1 = 324,
+    TS_RAD_AUX_SYM_BOOL_LIST_REPEAT1 = 325,
+    TS_RAD_AUX_SYM_LIST_REPEAT1 = 326,
+    TS_RAD_AUX_SYM_MAP_REPEAT1 = 327,
+    TS_RAD_AUX_SYM_STRING_CONTENTS_REPEAT1 = 328,
+    TS_RAD_SYM_ERROR = 65535,
+};
+
+enum ts_rad_field {
+    TS_RAD_FIELD_ALIGNMENT = 1,
+    TS_RAD_FIELD_ALT = 2,
+    TS_RAD_FIELD_ANY = 3,
+    TS_RAD_FIELD_ARG = 4,
+    TS_RAD_FIELD_ARG_NAME = 5,
+    TS_RAD_FIELD_BACKSLASH = 6,
+    TS_RAD_FIELD_BACKTICK = 7,
+    TS_RAD_FIELD_BLOCK_COLON = 8,
+    TS_RAD_FIELD_CALLBACK_IDENTIFIER = 9,
+    TS_RAD_FIELD_CALLBACK_LAMBDA = 10,
+    TS_RAD_FIELD_CALLS = 11,
+    TS_RAD_FIELD_CASE = 12,
+    TS_RAD_FIELD_CASE_KEY = 13,
+    TS_RAD_FIELD_CATCH = 14,
+    TS_RAD_FIELD_CLOSE_BRACKET = 15,
+    TS_RAD_FIELD_CLOSER = 16,
+    TS_RAD_FIELD_COLOR = 17,
+    TS_RAD_FIELD_COMMAND = 18,
+    TS_RAD_FIELD_COMMENT = 19,
+    TS_RAD_FIELD_CONDITION = 20,
+    TS_RAD_FIELD_CONTENT = 21,
+    TS_RAD_FIELD_CONTENTS = 22,
+    TS_RAD_FIELD_CONTEXT = 23,
+    TS_RAD_FIELD_DECLARATION = 24,
+    TS_RAD_FIELD_DECLARED_TYPE = 25,
+    TS_RAD_FIELD_DEFAULT = 26,
+    TS_RAD_FIELD_DELEGATE = 27,
+    TS_RAD_FIELD_DESCRIPTION = 28,
+    TS_RAD_FIELD_DISCRIMINANT = 29,
+    TS_RAD_FIELD_DOUBLE_QUOTE = 30,
+    TS_RAD_FIELD_END = 31,
+    TS_RAD_FIELD_ENUM = 32,
+    TS_RAD_FIELD_ENUM_CONSTRAINT = 33,
+    TS_RAD_FIELD_EXCLUDED = 34,
+    TS_RAD_FIELD_EXCLUDES = 35,
+    TS_RAD_FIELD_EXCLUDES_CONSTRAINT = 36,
+    TS_RAD_FIELD_EXPR = 37,
+    TS_RAD_FIELD_FALSE_BRANCH = 38,
+    TS_RAD_FIELD_FILL_ALIGNMENT = 39,
+    TS_RAD_FIELD_FIRST = 40,
+    TS_RAD_FIELD_FORMAT = 41,
+    TS_RAD_FIELD_FUNC = 42,
+    TS_RAD_FIELD_GROUP = 43,
+    TS_RAD_FIELD_IDENTIFIER = 44,
+    TS_RAD_FIELD_INDEX = 45,
+    TS_RAD_FIELD_INDEXING = 46,
+    TS_RAD_FIELD_INTERPOLATION = 47,
+    TS_RAD_FIELD_KEY = 48,
+    TS_RAD_FIELD_KEY_NAME = 49,
+    TS_RAD_FIELD_KEY_TYPE = 50,
+    TS_RAD_FIELD_KEYWORD = 51,
+    TS_RAD_FIELD_LAMBDA = 52,
+    TS_RAD_FIELD_LEAF_TYPE = 53,
+    TS_RAD_FIELD_LEFT = 54,
+    TS_RAD_FIELD_LEFTS = 55,
+    TS_RAD_FIELD_LEN_CONSTRAINT = 56,
+    TS_RAD_FIELD_LIST = 57,
+    TS_RAD_FIELD_LIST_ENTRY = 58,
+    TS_RAD_FIELD_MAP_ENTRY = 59,
+    TS_RAD_FIELD_MAX = 60,
+    TS_RAD_FIELD_MIN = 61,
+    TS_RAD_FIELD_MOD_STMT = 62,
+    TS_RAD_FIELD_MODIFIER = 63,
+    TS_RAD_FIELD_MUTUALLY = 64,
+    TS_RAD_FIELD_NAME = 65,
+    TS_RAD_FIELD_NAMED_ARG = 66,
+    TS_RAD_FIELD_NAMED_ENTRY = 67,
+    TS_RAD_FIELD_NAMED_ONLY_PARAM = 68,
+    TS_RAD_FIELD_NEWLINE = 69,
+    TS_RAD_FIELD_NORMAL_PARAM = 70,
+    TS_RAD_FIELD_OP = 71,
+    TS_RAD_FIELD_OPEN_BRACKET = 72,
+    TS_RAD_FIELD_OPENER = 73,
+    TS_RAD_FIELD_OPTIONAL = 74,
+    TS_RAD_FIELD_PADDING = 75,
+    TS_RAD_FIELD_PARAM = 76,
+    TS_RAD_FIELD_PRECISION = 77,
+    TS_RAD_FIELD_RAD_TYPE = 78,
+    TS_RAD_FIELD_RANGE_CONSTRAINT = 79,
+    TS_RAD_FIELD_REGEX = 80,
+    TS_RAD_FIELD_REGEX_CONSTRAINT = 81,
+    TS_RAD_FIELD_RENAME = 82,
+    TS_RAD_FIELD_REQUIRED = 83,
+    TS_RAD_FIELD_REQUIRES = 84,
+    TS_RAD_FIELD_REQUIRES_CONSTRAINT = 85,
+    TS_RAD_FIELD_RETURN_TYPE = 86,
+    TS_RAD_FIELD_RIGHT = 87,
+    TS_RAD_FIELD_ROOT = 88,
+    TS_RAD_FIELD_SECOND = 89,
+    TS_RAD_FIELD_SEGMENT = 90,
+    TS_RAD_FIELD_SHORTHAND = 91,
+    TS_RAD_FIELD_SINGLE_QUOTE = 92,
+    TS_RAD_FIELD_SOURCE = 93,
+    TS_RAD_FIELD_SPECIFIER = 94,
+    TS_RAD_FIELD_START = 95,
+    TS_RAD_FIELD_STMT = 96,
+    TS_RAD_FIELD_TAB = 97,
+    TS_RAD_FIELD_THOUSANDS_SEPARATOR = 98,
+    TS_RAD_FIELD_TRUE_BRANCH = 99,
+    TS_RAD_FIELD_TYPE = 100,
+    TS_RAD_FIELD_VALUE = 101,
+    TS_RAD_FIELD_VALUE_TYPE = 102,
+    TS_RAD_FIELD_VALUES = 103,
+    TS_RAD_FIELD_VARARG_MARKER = 104,
+    TS_RAD_FIELD_VARARG_PARAM = 105,
+    TS_RAD_FIELD_VARIADIC_MARKER = 106,
+};
+
+#ifdef TREE_SITTER_API_H_
+static inline uint64_t ts_rad_fnv1a(uint64_t hash, const char *name) {
+    for (const char *c = name ? name : ""; ; c++) {
+        hash = (hash ^ (uint8_t)*c) * 0x100000001b3ULL;
+        if (!*c) return hash;
+    }
+}
+
+// Returns whether the linked parser was generated from the same grammar as
+// this header, by comparing every symbol and field name.
+static inline bool tree_sitter_rad_symbols_match(const TSLanguage *language) {
+    if (ts_language_symbol_count(language) != TS_RAD_SYMBOL_COUNT ||
+        ts_language_field_count(language) != TS_RAD_FIELD_COUNT) {
+        return false;
+    }
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (uint32_t id = 0; id < TS_RAD_SYMBOL_COUNT; id++) {
+        hash = ts_rad_fnv1a(hash, ts_language_symbol_name(language, (TSSymbol)id));
+    }
+    for (uint32_t id = 1; id <= TS_RAD_FIELD_COUNT; id++) {
+        hash = ts_rad_fnv1a(hash, ts_language_field_name_for_id(language, (TSFieldId)id));
+    }
+    return hash == TS_RAD_SYMBOL_HASH;
+}
+#endif
+
+#endif // TREE_SITTER_RAD_SYMBOLS_H_
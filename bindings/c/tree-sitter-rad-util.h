@@ -0,0 +1,322 @@
+#ifndef TREE_SITTER_RAD_UTIL_H_
+#define TREE_SITTER_RAD_UTIL_H_
+
+// Helpers for embedding the Rad grammar, built as libtree-sitter-rad-util.
+// Unlike tree-sitter-rad.h, this header needs the tree-sitter runtime's
+// tree_sitter/api.h.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A read-only mapping of a whole file. Trees parsed from it keep byte offsets
+// into `data`, which stays valid until the file is unmapped.
+typedef struct TSRadMappedFile {
+    const char *data;
+    size_t length;
+    void *handle; // Platform mapping state; not for use by callers.
+} TSRadMappedFile;
+
+// Maps the file at `path` into memory. Returns 0, or an errno value on
+// failure: EFBIG for files tree-sitter can't address (4 GiB and up). An empty
+// file maps to a zero-length `data`.
+int tree_sitter_rad_map_file(TSRadMappedFile *file, const char *path);
+
+// Releases a mapping made by tree_sitter_rad_map_file.
+void tree_sitter_rad_unmap_file(TSRadMappedFile *file);
+
+// Returns a TSInput that hands the parser chunks of the mapping itself, so
+// parsing never copies the source. `file` must outlive the parse.
+TSInput tree_sitter_rad_mapped_input(const TSRadMappedFile *file);
+
+// Maps `path` into `file` and parses it with `parser`, which must already have
+// the Rad language set. Returns NULL if mapping or parsing fails; in the
+// former case `*error` (if given) holds the errno value, otherwise 0. On
+// success the caller unmaps `file` once it no longer needs the source text.
+TSTree *tree_sitter_rad_parse_file(TSParser *parser, const char *path, TSRadMappedFile *file, int *error);
+
+// Returns the length of the script's preamble: the shebang, file header,
+// `args` block and `command` blocks, with the blank and comment lines around
+// them. The preamble ends where the first statement's line starts.
+uint32_t tree_sitter_rad_preamble_length(const char *source, uint32_t length);
+
+// Parses only the preamble of `source`, which is what `--help`, argument
+// validation and completion need. The tree holds a source_file with no
+// statements; its offsets are offsets into `source`. Costs the same however
+// long the rest of the script is.
+TSTree *tree_sitter_rad_parse_preamble(TSParser *parser, const char *source, uint32_t length);
+
+// An indented block whose parse can be put off: a top-level `fn_named`,
+// `cmd_block` or `rad_block` body.
+typedef enum TSRadBodyKind {
+    TSRadBodyFunction,
+    TSRadBodyCommand,
+    TSRadBodyRad,
+} TSRadBodyKind;
+
+typedef struct TSRadBody {
+    TSRadBodyKind kind;
+    TSRange range;        // From the start of the header line to the end of the body.
+    uint32_t body_byte;   // Start of the body's first line.
+    TSPoint body_point;
+} TSRadBody;
+
+// A tree whose bodies were skipped, plus what's needed to parse them later.
+typedef struct TSRadLazyTree TSRadLazyTree;
+
+// Parses `source` without the bodies of its top-level functions, commands
+// and rad blocks, so the cost follows the number of definitions rather than
+// their size. Each skipped body parses as a single placeholder statement
+// (`pass`, `default` or `quiet`) inside the body's range; the tree's other
+// offsets are those of the full parse. `source` must outlive the result.
+// Returns NULL if the parse fails.
+TSRadLazyTree *tree_sitter_rad_parse_lazy(TSParser *parser, const char *source, uint32_t length);
+
+void tree_sitter_rad_lazy_tree_delete(TSRadLazyTree *self);
+
+// The tree with bodies skipped. Owned by `self`.
+const TSTree *tree_sitter_rad_lazy_tree_skeleton(const TSRadLazyTree *self);
+
+// The skipped bodies, in source order.
+const TSRadBody *tree_sitter_rad_lazy_tree_bodies(const TSRadLazyTree *self, uint32_t *count);
+
+// Returns the index of the skipped body containing `byte`, or UINT32_MAX.
+uint32_t tree_sitter_rad_lazy_tree_body_at(const TSRadLazyTree *self, uint32_t byte);
+
+// Parses skipped body `index` together with its header. The result is a
+// source_file holding just that `fn_named`, `cmd_block` or `rad_block`, with
+// offsets into the original source.
+TSTree *tree_sitter_rad_parse_body(TSParser *parser, const TSRadLazyTree *self, uint32_t index);
+
+// Parses `source` for running one subcommand: the command at `path` (outer
+// name first, `depth` names) is parsed in full, along with every top-level
+// function it refers to, directly or through other functions. Everything
+// tree_sitter_rad_parse_lazy skips is skipped, and so are the bodies of the
+// other commands at each level of the path, which stay available through
+// tree_sitter_rad_parse_body. Returns NULL if no command matches `path` or
+// the parse fails.
+TSRadLazyTree *tree_sitter_rad_parse_command(TSParser *parser, const char *source, uint32_t length,
+                                             const char *const *path, uint32_t depth);
+
+// Line scanning
+//
+// The helpers above find statements without parsing, from a pass over the
+// source that classifies 64 bytes at a time and looks only at line breaks,
+// quotes, brackets and comment starts. The same pass is available for
+// outlines and folding.
+
+// Ways of classifying bytes; each finds the same lines.
+typedef enum TSRadScanKernel {
+    TSRadScanKernelBest,
+    TSRadScanKernelScalar,
+    TSRadScanKernelSSE2,
+    TSRadScanKernelAVX2,
+} TSRadScanKernel;
+
+// Whether `kernel` can run on this machine. Best and Scalar always can.
+bool tree_sitter_rad_scan_kernel_supported(TSRadScanKernel kernel);
+
+// TSRadLine flags.
+enum
+{
+    // No code, only whitespace and comments.
+    TS_RAD_LINE_BLANK = 1 << 0,
+    // Starts outside any string, bracket, `---` text or backslash
+    // continuation, so its indent is the statement's.
+    TS_RAD_LINE_LOGICAL = 1 << 1,
+    // Opens a file header or command description.
+    TS_RAD_LINE_FENCE = 1 << 2,
+};
+
+typedef struct TSRadLine {
+    uint32_t start_byte;
+    // End of the line's code, before trailing whitespace and comments.
+    uint32_t code_end_byte;
+    // Width of the leading whitespace; tabs count 8, as in the grammar.
+    uint32_t indent;
+    uint32_t flags;
+} TSRadLine;
+
+// Scans the lines of `source` with `kernel`, or the best supported kernel
+// if it can't run here, and stores the first `capacity` of them in `lines`.
+// Returns the number of lines, which may be more than `capacity`.
+uint32_t tree_sitter_rad_scan_lines(const char *source, uint32_t length, TSRadScanKernel kernel, TSRadLine *lines,
+                                    uint32_t capacity);
+
+// Serialized trees
+//
+// A CST file is a TSRadCstHeader followed by node_count TSRadCstNode
+// records, all little-endian, and optionally the source. Records are in
+// pre-order, so a node's first child, if it has any, is the record after it.
+// CST.md specifies the format for readers in other languages.
+
+#define TS_RAD_CST_VERSION 1
+
+// Marks a missing parent, first child or next sibling.
+#define TS_RAD_CST_NO_NODE UINT32_MAX
+
+// TSRadCstHeader flags.
+enum
+{
+    // The source_length bytes of source follow the last record.
+    TS_RAD_CST_EMBEDDED_SOURCE = 1 << 0,
+};
+
+// TSRadCstNode flags.
+enum
+{
+    TS_RAD_CST_NAMED = 1 << 0,
+    TS_RAD_CST_EXTRA = 1 << 1,
+    TS_RAD_CST_MISSING = 1 << 2,
+    TS_RAD_CST_ERROR = 1 << 3,
+    TS_RAD_CST_HAS_ERROR = 1 << 4,
+};
+
+typedef struct TSRadCstHeader {
+    char magic[4]; // "RCST"
+    uint16_t version;
+    uint16_t flags;
+    // The grammar the tree was parsed with; kind and field ids are only
+    // meaningful for the same grammar.
+    uint32_t language_version;
+    uint32_t symbol_count;
+    uint32_t field_count;
+    uint32_t state_count;
+    uint64_t grammar_hash;
+    // The source the tree was parsed from.
+    uint64_t source_hash;
+    uint32_t source_length;
+    uint32_t node_count;
+    uint32_t node_size; // sizeof(TSRadCstNode) when written.
+    uint32_t reserved[3];
+} TSRadCstHeader;
+
+typedef struct TSRadCstNode {
+    TSSymbol kind_id;
+    TSFieldId field_id; // The field the node holds in its parent, or 0.
+    uint32_t start_byte;
+    uint32_t end_byte;
+    uint32_t parent;
+    uint32_t first_child;
+    uint32_t next_sibling;
+    TSPoint start_point;
+    TSPoint end_point;
+    uint16_t flags;
+    uint16_t reserved;
+} TSRadCstNode;
+
+// A read-only view of a serialized tree; it points into the bytes it was
+// opened from.
+typedef struct TSRadCst {
+    const TSRadCstHeader *header;
+    const TSRadCstNode *nodes;
+    uint32_t node_count;
+    const char *source; // The embedded source, or NULL.
+} TSRadCst;
+
+// Hashes a source the way CST headers and the parse cache do.
+uint64_t tree_sitter_rad_source_hash(const char *source, uint32_t length);
+
+// Hashes the symbol and field names of `language` along with its table
+// sizes, which changes whenever the grammar does.
+uint64_t tree_sitter_rad_grammar_hash(const TSLanguage *language);
+
+// Serializes `tree`, parsed from `source`, into a malloc'd buffer stored in
+// `*data`, with a copy of the source if `embed_source` is set. Returns its
+// size, or 0 if out of memory.
+size_t tree_sitter_rad_cst_write(const TSTree *tree, const char *source, uint32_t length, bool embed_source,
+                                 void **data);
+
+// Opens a serialized tree in place. Returns false if `data` isn't a complete
+// CST of a version this library reads, if a record links outside the records
+// or out of pre-order or has a byte range past the source, if `data` isn't
+// 8-byte aligned, or if the host isn't little-endian. Files from elsewhere can
+// be walked safely once opened.
+bool tree_sitter_rad_cst_open(TSRadCst *cst, const void *data, size_t size);
+
+// Whether `cst` was written for `language`, so its ids can be used with it.
+bool tree_sitter_rad_cst_matches_language(const TSRadCst *cst, const TSLanguage *language);
+
+// Parse cache
+//
+// Trees are stored under a cache directory as CST files named after the
+// grammar and source hashes. A hit maps the file instead of parsing.
+
+typedef struct TSRadCachedCst {
+    TSRadCst cst;
+    bool hit;
+    TSRadMappedFile file; // The cache file, on a hit.
+    void *data;           // The freshly written tree, on a miss.
+} TSRadCachedCst;
+
+// Returns the tree for `source` from the cache in `directory`, creating it and
+// its parents if needed. On a miss, `source` is parsed with `parser` and the
+// result stored; failing to store it isn't an error. Returns 0, or an errno
+// value if there is no tree to return.
+int tree_sitter_rad_cache_load(const char *directory, TSParser *parser, const char *source, uint32_t length,
+                               TSRadCachedCst *result);
+
+// Releases a tree returned by tree_sitter_rad_cache_load.
+void tree_sitter_rad_cache_release(TSRadCachedCst *result);
+
+// Parses `source` on up to `threads` threads and stores the result as a CST
+// in a malloc'd buffer in `*data`, as tree_sitter_rad_cst_write would. The
+// source is split into chunks of about equal size at top-level statements;
+// each chunk is parsed on its own, and their nodes are joined under one
+// source_file. For a source without syntax errors the CST is identical to
+// writing a sequential parse; where there are errors, each chunk recovers
+// from them separately. Returns the CST's size, or 0 if parsing fails or
+// memory runs out.
+size_t tree_sitter_rad_parse_chunked(const TSLanguage *language, const char *source, uint32_t length,
+                                     uint32_t threads, bool embed_source, void **data);
+
+// Streaming
+//
+// A TSRadStream reads a script from a file descriptor, such as a pipe from
+// `rad -`, and parses it as it arrives instead of after the whole input has
+// been buffered. Offsets in its trees are offsets into the whole input.
+
+typedef struct TSRadStream TSRadStream;
+
+// Reads `fd` in chunks of up to `chunk_size` bytes, or 64 KiB if 0. The
+// stream doesn't close `fd`. Returns NULL if out of memory.
+TSRadStream *tree_sitter_rad_stream_new(int fd, uint32_t chunk_size);
+
+void tree_sitter_rad_stream_delete(TSRadStream *self);
+
+// Returns a TSInput that reads the stream, waiting for input as the parser
+// gets to it, so a single parse of the whole script overlaps reading it.
+// Don't mix with tree_sitter_rad_stream_parse_next.
+TSInput tree_sitter_rad_stream_input(TSRadStream *self);
+
+// Waits until the next part of the script has arrived and parses it with
+// `parser`: first the preamble, if there is one, and then each time the
+// top-level statements that have arrived whole, at least one. Each tree is
+// a source_file holding that part, with the nodes a parse of the whole
+// script would have there. Returns NULL at the end of input, or if parsing
+// fails.
+TSTree *tree_sitter_rad_stream_parse_next(TSRadStream *self, TSParser *parser);
+
+// Returns the input from `byte` up to the last byte read, storing its
+// length in `*length`, or NULL if `byte` has been released or not read yet.
+// The pointer is valid until the next call to
+// tree_sitter_rad_stream_parse_next or read of the TSInput.
+const char *tree_sitter_rad_stream_text(const TSRadStream *self, uint32_t byte, uint32_t *length);
+
+// Lets the stream drop the input before `byte`, once the trees over it no
+// longer need their text. The input still to be parsed is always kept.
+void tree_sitter_rad_stream_release(TSRadStream *self, uint32_t byte);
+
+// Returns the errno value of a failed read, or EFBIG for input of 4 GiB or
+// more, after which the stream acts as if the input had ended; otherwise 0.
+int tree_sitter_rad_stream_error(const TSRadStream *self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_RAD_UTIL_H_
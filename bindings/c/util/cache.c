@@ -0,0 +1,185 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "tree-sitter-rad-util.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#define make_directory(path) _mkdir(path)
+#define process_id() _getpid()
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#define make_directory(path) mkdir(path, 0777)
+#define process_id() getpid()
+#endif
+
+// Every grammar and source pair gets its own file, so a grammar upgrade
+// never reads an old tree; stale files are left for the user to clear.
+static char *cache_path(const char *directory, uint64_t grammar_hash, uint64_t source_hash, const char *suffix)
+{
+    size_t size = strlen(directory) + 64;
+    char *path = malloc(size);
+    if (path != NULL)
+    {
+        snprintf(path, size, "%s/%016" PRIx64 "%016" PRIx64 "%s", directory, grammar_hash, source_hash, suffix);
+    }
+    return path;
+}
+
+static bool load_hit(const char *path, const TSLanguage *language, uint64_t source_hash, uint32_t length,
+                     TSRadCachedCst *result)
+{
+    if (tree_sitter_rad_map_file(&result->file, path) != 0)
+    {
+        return false;
+    }
+    const TSRadCstHeader *header = (const TSRadCstHeader *)result->file.data;
+    if (tree_sitter_rad_cst_open(&result->cst, result->file.data, result->file.length) &&
+        header->source_hash == source_hash && header->source_length == length &&
+        tree_sitter_rad_cst_matches_language(&result->cst, language))
+    {
+        result->hit = true;
+        return true;
+    }
+    tree_sitter_rad_unmap_file(&result->file);
+    return false;
+}
+
+static inline bool is_separator(char c)
+{
+#ifdef _WIN32
+    return c == '/' || c == '\\';
+#else
+    return c == '/';
+#endif
+}
+
+// Creates `directory` and any missing parents. Returns false if `directory`
+// doesn't exist afterwards.
+static bool make_directories(const char *directory)
+{
+    char *path = malloc(strlen(directory) + 1);
+    if (path == NULL)
+    {
+        return false;
+    }
+    strcpy(path, directory);
+    for (char *c = path; *c != '\0'; c++)
+    {
+        if (c > path && is_separator(*c) && !is_separator(c[-1]))
+        {
+            // A parent that can't be made shows up as a failure below.
+            char separator = *c;
+            *c = '\0';
+            make_directory(path);
+            *c = separator;
+        }
+    }
+    bool made = make_directory(path) == 0 || errno == EEXIST;
+    free(path);
+    return made;
+}
+
+// Writes to a temporary file of its own first, so a concurrent reader never
+// sees a partial tree and concurrent writers, in this process or others,
+// never share one.
+static void store(const char *directory, uint64_t grammar_hash, uint64_t source_hash, const char *path,
+                  const void *data, size_t size)
+{
+    FILE *file = NULL;
+    char *temporary = NULL;
+    for (unsigned attempt = 0; file == NULL && attempt < 64; attempt++)
+    {
+        char suffix[48];
+        snprintf(suffix, sizeof(suffix), ".%d.%u.tmp", (int)process_id(), attempt);
+        free(temporary);
+        temporary = cache_path(directory, grammar_hash, source_hash, suffix);
+        if (temporary == NULL)
+        {
+            return;
+        }
+        // "x" fails if the file exists, so a name another thread has taken
+        // is passed over.
+        file = fopen(temporary, "wbx");
+        if (file == NULL && errno != EEXIST)
+        {
+            break;
+        }
+    }
+    if (file == NULL)
+    {
+        free(temporary);
+        return;
+    }
+    bool written = fwrite(data, 1, size, file) == size;
+    written = fclose(file) == 0 && written;
+#ifdef _WIN32
+    // rename doesn't replace an existing file on Windows.
+    remove(path);
+#endif
+    if (!written || rename(temporary, path) != 0)
+    {
+        remove(temporary);
+    }
+    free(temporary);
+}
+
+int tree_sitter_rad_cache_load(const char *directory, TSParser *parser, const char *source, uint32_t length,
+                               TSRadCachedCst *result)
+{
+    memset(result, 0, sizeof(*result));
+    const TSLanguage *language = ts_parser_language(parser);
+    uint64_t grammar_hash = tree_sitter_rad_grammar_hash(language);
+    uint64_t source_hash = tree_sitter_rad_source_hash(source, length);
+    char *path = cache_path(directory, grammar_hash, source_hash, ".rcst");
+    if (path == NULL)
+    {
+        return ENOMEM;
+    }
+    if (load_hit(path, language, source_hash, length, result))
+    {
+        free(path);
+        return 0;
+    }
+
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source, length);
+    if (tree == NULL)
+    {
+        free(path);
+        return ECANCELED;
+    }
+    size_t size = tree_sitter_rad_cst_write(tree, source, length, false, &result->data);
+    ts_tree_delete(tree);
+    if (size == 0)
+    {
+        free(path);
+        return ENOMEM;
+    }
+    tree_sitter_rad_cst_open(&result->cst, result->data, size);
+
+    if (make_directories(directory))
+    {
+        store(directory, grammar_hash, source_hash, path, result->data, size);
+    }
+    free(path);
+    return 0;
+}
+
+void tree_sitter_rad_cache_release(TSRadCachedCst *result)
+{
+    if (result->hit)
+    {
+        tree_sitter_rad_unmap_file(&result->file);
+    }
+    free(result->data);
+    memset(result, 0, sizeof(*result));
+}
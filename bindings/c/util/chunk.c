@@ -0,0 +1,258 @@
+#include "tree-sitter-rad-util.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "cst.h"
+#include "lines.h"
+
+// A chunk starts at a top-level statement after the preamble, so every
+// chunk parses on its own to the nodes the whole file would have; see
+// ts_rad_line_starts_statement.
+
+typedef struct Chunk Chunk;
+typedef void (*ChunkTask)(Chunk *chunk);
+
+struct Chunk
+{
+    const TSLanguage *language;
+    const char *source;
+    uint32_t length;
+    TSRange range;
+    TSTree *tree;
+    // Where the root's children go in the stitched records, and how many
+    // records they take.
+    TSRadCstNode *nodes;
+    uint32_t base;
+    uint32_t count;
+
+    ChunkTask task;
+#ifdef _WIN32
+    HANDLE thread;
+#else
+    pthread_t thread;
+#endif
+    bool started;
+};
+
+// Splits `source` into at most `max_count` chunks of roughly equal size.
+// Returns the number of chunks.
+static uint32_t split(Chunk *chunks, const char *source, uint32_t length, uint32_t max_count)
+{
+    uint32_t count = 1;
+    chunks[0].range = (TSRange){.start_point = {0, 0}, .start_byte = 0};
+    uint32_t preamble = tree_sitter_rad_preamble_length(source, length);
+    uint64_t target = (uint64_t)length / max_count;
+
+    RadLineScanner scanner;
+    ts_rad_lines_init(&scanner, source, length);
+    RadLine line, previous = {.logical = false};
+    while (count < max_count && ts_rad_lines_next(&scanner, &line))
+    {
+        if (line.blank)
+        {
+            continue;
+        }
+        if (line.start >= preamble && line.start >= target && ts_rad_line_starts_statement(source, &line, &previous))
+        {
+            chunks[count - 1].range.end_byte = line.start;
+            chunks[count - 1].range.end_point = (TSPoint){line.row, 0};
+            chunks[count].range = (TSRange){.start_point = {line.row, 0}, .start_byte = line.start};
+            count++;
+            target = (uint64_t)length * count / max_count;
+        }
+        previous = line;
+    }
+    chunks[count - 1].range.end_byte = UINT32_MAX;
+    chunks[count - 1].range.end_point = (TSPoint){UINT32_MAX, UINT32_MAX};
+    return count;
+}
+
+static void parse_chunk(Chunk *chunk)
+{
+    TSParser *parser = ts_parser_new();
+    if (ts_parser_set_language(parser, chunk->language) && ts_parser_set_included_ranges(parser, &chunk->range, 1))
+    {
+        chunk->tree = ts_parser_parse_string(parser, NULL, chunk->source, chunk->length);
+    }
+    ts_parser_delete(parser);
+}
+
+static void write_chunk(Chunk *chunk)
+{
+    // The chunk's root is left out; the stitched root stands in for it.
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(chunk->tree));
+    if (ts_tree_cursor_goto_first_child(&cursor))
+    {
+        ts_rad_cst_write_nodes(&cursor, chunk->nodes, chunk->base, 0, chunk->base + chunk->count);
+    }
+    ts_tree_cursor_delete(&cursor);
+}
+
+#ifdef _WIN32
+
+static DWORD WINAPI run_chunk(LPVOID payload)
+{
+    Chunk *chunk = payload;
+    chunk->task(chunk);
+    return 0;
+}
+
+static bool start_thread(Chunk *chunk)
+{
+    chunk->thread = CreateThread(NULL, 0, run_chunk, chunk, 0, NULL);
+    return chunk->thread != NULL;
+}
+
+static void join_thread(Chunk *chunk)
+{
+    WaitForSingleObject(chunk->thread, INFINITE);
+    CloseHandle(chunk->thread);
+}
+
+#else
+
+static void *run_chunk(void *payload)
+{
+    Chunk *chunk = payload;
+    chunk->task(chunk);
+    return NULL;
+}
+
+static bool start_thread(Chunk *chunk) { return pthread_create(&chunk->thread, NULL, run_chunk, chunk) == 0; }
+
+static void join_thread(Chunk *chunk) { pthread_join(chunk->thread, NULL); }
+
+#endif
+
+// Runs `task` on every chunk, each on its own thread apart from the first,
+// which runs on the calling thread. A chunk whose thread can't be started
+// runs on the calling thread afterwards.
+static void run_chunks(Chunk *chunks, uint32_t count, ChunkTask task)
+{
+    for (uint32_t i = 1; i < count; i++)
+    {
+        chunks[i].task = task;
+        chunks[i].started = start_thread(&chunks[i]);
+    }
+    task(&chunks[0]);
+    for (uint32_t i = 1; i < count; i++)
+    {
+        if (chunks[i].started)
+        {
+            join_thread(&chunks[i]);
+        }
+        else
+        {
+            task(&chunks[i]);
+        }
+    }
+}
+
+// Fills in the root record and links each chunk's top-level nodes to the
+// next chunk's.
+static void stitch(TSRadCstNode *nodes, const Chunk *chunks, uint32_t count)
+{
+    TSNode first = ts_tree_root_node(chunks[0].tree);
+    TSNode last = ts_tree_root_node(chunks[count - 1].tree);
+    uint16_t flags = TS_RAD_CST_NAMED | (ts_node_is_error(first) ? TS_RAD_CST_ERROR : 0);
+    nodes[0] = (TSRadCstNode){
+        .kind_id = ts_node_symbol(first),
+        .start_byte = ts_node_start_byte(first),
+        .end_byte = ts_node_end_byte(last),
+        .parent = TS_RAD_CST_NO_NODE,
+        .first_child = TS_RAD_CST_NO_NODE,
+        .next_sibling = TS_RAD_CST_NO_NODE,
+        .start_point = ts_node_start_point(first),
+        .end_point = ts_node_end_point(last),
+    };
+
+    uint32_t tail = TS_RAD_CST_NO_NODE;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (ts_node_has_error(ts_tree_root_node(chunks[i].tree)))
+        {
+            flags |= TS_RAD_CST_HAS_ERROR;
+        }
+        if (chunks[i].count == 0)
+        {
+            continue;
+        }
+        if (tail == TS_RAD_CST_NO_NODE)
+        {
+            nodes[0].first_child = chunks[i].base;
+        }
+        else
+        {
+            nodes[tail].next_sibling = chunks[i].base;
+        }
+        for (tail = chunks[i].base; nodes[tail].next_sibling != TS_RAD_CST_NO_NODE; tail = nodes[tail].next_sibling)
+        {
+        }
+    }
+    nodes[0].flags = flags;
+}
+
+size_t tree_sitter_rad_parse_chunked(const TSLanguage *language, const char *source, uint32_t length,
+                                     uint32_t threads, bool embed_source, void **data)
+{
+    Chunk *chunks = calloc(threads > 0 ? threads : 1, sizeof(Chunk));
+    if (chunks == NULL)
+    {
+        return 0;
+    }
+    uint32_t count = split(chunks, source, length, threads > 0 ? threads : 1);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        chunks[i].language = language;
+        chunks[i].source = source;
+        chunks[i].length = length;
+    }
+    run_chunks(chunks, count, parse_chunk);
+
+    // Record 0 is the stitched root, and each chunk's records follow the
+    // previous chunk's.
+    size_t size = 0;
+    uint32_t capacity = 1;
+    bool parsed = true;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (chunks[i].tree == NULL)
+        {
+            parsed = false;
+            continue;
+        }
+        chunks[i].base = capacity;
+        chunks[i].count = ts_node_descendant_count(ts_tree_root_node(chunks[i].tree)) - 1;
+        capacity += chunks[i].count;
+    }
+    TSRadCstHeader *header = parsed ? ts_rad_cst_new(language, source, length, capacity, embed_source) : NULL;
+    if (header != NULL)
+    {
+        TSRadCstNode *nodes = (TSRadCstNode *)(header + 1);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            chunks[i].nodes = nodes;
+        }
+        run_chunks(chunks, count, write_chunk);
+        stitch(nodes, chunks, count);
+        *data = header;
+        size = ts_rad_cst_finish(header, capacity, source);
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (chunks[i].tree != NULL)
+        {
+            ts_tree_delete(chunks[i].tree);
+        }
+    }
+    free(chunks);
+    return size;
+}
@@ -0,0 +1,196 @@
+#include "tree-sitter-rad-util.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "lazy.h"
+
+// A command parse is a lazy parse that keeps a few bodies: the commands along
+// the path, and every top-level function the selected command names,
+// followed transitively. Names are matched as text, so a function mentioned
+// only in a comment or string is parsed too; that costs time, never
+// correctness.
+
+static inline bool is_identifier_char(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static bool has_name(const TSRadLazyTree *self, uint32_t index, const char *name, uint32_t name_length)
+{
+    uint32_t length;
+    const char *text = ts_rad_body_name(self, index, &length);
+    return length == name_length && memcmp(text, name, length) == 0;
+}
+
+// Returns the command body named `name` among bodies [from, to), or
+// UINT32_MAX.
+static uint32_t find_command(const TSRadLazyTree *self, uint32_t from, uint32_t to, const char *name)
+{
+    for (uint32_t i = from; i < to; i++)
+    {
+        if (self->bodies[i].kind == TSRadBodyCommand && has_name(self, i, name, (uint32_t)strlen(name)))
+        {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+static uint32_t hash_name(const char *name, uint32_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Top-level functions by name: open addressing over body indices plus one.
+typedef struct
+{
+    uint32_t *slots;
+    uint32_t mask;
+} FunctionTable;
+
+static bool function_table_init(FunctionTable *table, const TSRadLazyTree *self, uint32_t count)
+{
+    uint32_t size = 16;
+    while (size < 2 * count)
+    {
+        size *= 2;
+    }
+    table->slots = calloc(size, sizeof(uint32_t));
+    table->mask = size - 1;
+    if (table->slots == NULL)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (self->bodies[i].kind != TSRadBodyFunction)
+        {
+            continue;
+        }
+        uint32_t length;
+        const char *name = ts_rad_body_name(self, i, &length);
+        uint32_t slot = hash_name(name, length) & table->mask;
+        while (table->slots[slot] != 0)
+        {
+            slot = (slot + 1) & table->mask;
+        }
+        table->slots[slot] = i + 1;
+    }
+    return true;
+}
+
+static uint32_t function_table_find(const FunctionTable *table, const TSRadLazyTree *self, const char *name,
+                                    uint32_t length)
+{
+    for (uint32_t slot = hash_name(name, length) & table->mask; table->slots[slot] != 0;
+         slot = (slot + 1) & table->mask)
+    {
+        if (has_name(self, table->slots[slot] - 1, name, length))
+        {
+            return table->slots[slot] - 1;
+        }
+    }
+    return UINT32_MAX;
+}
+
+// Keeps every function among the first `count` bodies that body `root`
+// refers to, directly or through other kept functions. A function may be kept
+// already, by a body too short to skip, without its callees being kept, so
+// visits are tracked apart from `keep`.
+static bool keep_callees(TSRadLazyTree *self, uint32_t count, uint32_t root)
+{
+    FunctionTable table;
+    uint32_t *pending = malloc(((size_t)count + 1) * sizeof(uint32_t));
+    bool *visited = calloc(count > 0 ? count : 1, sizeof(bool));
+    if (pending == NULL || visited == NULL || !function_table_init(&table, self, count))
+    {
+        free(pending);
+        free(visited);
+        return false;
+    }
+
+    const char *text = self->source;
+    uint32_t size = 0;
+    pending[size++] = root;
+    while (size > 0)
+    {
+        const TSRadBody *body = &self->bodies[pending[--size]];
+        uint32_t i = body->body_byte, end = body->range.end_byte;
+        while (i < end)
+        {
+            if (!is_identifier_char(text[i]) || (text[i] >= '0' && text[i] <= '9'))
+            {
+                i++;
+                continue;
+            }
+            uint32_t start = i;
+            while (i < end && is_identifier_char(text[i]))
+            {
+                i++;
+            }
+            uint32_t callee = function_table_find(&table, self, text + start, i - start);
+            if (callee != UINT32_MAX && !visited[callee])
+            {
+                visited[callee] = true;
+                self->placeholder[callee].keep = true;
+                pending[size++] = callee;
+            }
+        }
+    }
+    free(table.slots);
+    free(pending);
+    free(visited);
+    return true;
+}
+
+TSRadLazyTree *tree_sitter_rad_parse_command(TSParser *parser, const char *source, uint32_t length,
+                                             const char *const *path, uint32_t depth)
+{
+    TSRadLazyTree *self = ts_rad_lazy_tree_new(source, length);
+    if (self == NULL)
+    {
+        return NULL;
+    }
+    if (depth == 0 || !ts_rad_lazy_tree_find_bodies(self, 0, 0, length, 0, TS_RAD_ALL_BODY_KINDS))
+    {
+        tree_sitter_rad_lazy_tree_delete(self);
+        return NULL;
+    }
+
+    // Each level's siblings become skipped bodies of their own, nested in
+    // the kept parent.
+    uint32_t top_level = self->count;
+    uint32_t target = find_command(self, 0, top_level, path[0]);
+    for (uint32_t level = 1; level < depth && target != UINT32_MAX; level++)
+    {
+        self->placeholder[target].keep = true;
+        TSRadBody parent = self->bodies[target];
+        uint32_t from = self->count;
+        if (!ts_rad_lazy_tree_find_bodies(self, parent.body_byte, parent.body_point.row, parent.range.end_byte,
+                                          self->placeholder[target].indent, TS_RAD_BODY_KIND(TSRadBodyCommand)))
+        {
+            target = UINT32_MAX;
+            break;
+        }
+        target = find_command(self, from, self->count, path[level]);
+    }
+
+    if (target == UINT32_MAX || !keep_callees(self, top_level, target))
+    {
+        tree_sitter_rad_lazy_tree_delete(self);
+        return NULL;
+    }
+    self->placeholder[target].keep = true;
+    if (!ts_rad_lazy_tree_parse(self, parser))
+    {
+        tree_sitter_rad_lazy_tree_delete(self);
+        return NULL;
+    }
+    return self;
+}
@@ -0,0 +1,235 @@
+#include "tree-sitter-rad-util.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "cst.h"
+
+#define FNV_OFFSET 14695981039346656037ull
+#define FNV_PRIME 1099511628211ull
+
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t length)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+uint64_t tree_sitter_rad_source_hash(const char *source, uint32_t length)
+{
+    return fnv1a(FNV_OFFSET, source, length);
+}
+
+static uint64_t fnv1a_u32(uint64_t hash, uint32_t value)
+{
+    uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+    return fnv1a(hash, bytes, sizeof(bytes));
+}
+
+// Only what every binding's Language exposes goes into the hash, so the Go
+// and Rust writers compute the same value.
+uint64_t tree_sitter_rad_grammar_hash(const TSLanguage *language)
+{
+    uint32_t symbol_count = ts_language_symbol_count(language);
+    uint32_t field_count = ts_language_field_count(language);
+    uint64_t hash = fnv1a_u32(FNV_OFFSET, ts_language_version(language));
+    hash = fnv1a_u32(hash, symbol_count);
+    hash = fnv1a_u32(hash, field_count);
+    hash = fnv1a_u32(hash, ts_language_state_count(language));
+    for (TSSymbol symbol = 0; symbol < symbol_count; symbol++)
+    {
+        const char *name = ts_language_symbol_name(language, symbol);
+        hash = fnv1a(hash, name, strlen(name) + 1);
+    }
+    for (TSFieldId field = 1; field <= field_count; field++)
+    {
+        const char *name = ts_language_field_name_for_id(language, field);
+        hash = fnv1a(hash, name, strlen(name) + 1);
+    }
+    return hash;
+}
+
+static bool is_little_endian(void)
+{
+    uint16_t probe = 1;
+    return *(const uint8_t *)&probe == 1;
+}
+
+static inline void fill(TSRadCstNode *record, const TSTreeCursor *cursor, uint32_t parent)
+{
+    TSNode node = ts_tree_cursor_current_node(cursor);
+    uint16_t flags = 0;
+    flags |= ts_node_is_named(node) ? TS_RAD_CST_NAMED : 0;
+    flags |= ts_node_is_extra(node) ? TS_RAD_CST_EXTRA : 0;
+    flags |= ts_node_is_missing(node) ? TS_RAD_CST_MISSING : 0;
+    flags |= ts_node_is_error(node) ? TS_RAD_CST_ERROR : 0;
+    flags |= ts_node_has_error(node) ? TS_RAD_CST_HAS_ERROR : 0;
+    *record = (TSRadCstNode){
+        .kind_id = ts_node_symbol(node),
+        .field_id = ts_tree_cursor_current_field_id(cursor),
+        .start_byte = ts_node_start_byte(node),
+        .end_byte = ts_node_end_byte(node),
+        .parent = parent,
+        .first_child = TS_RAD_CST_NO_NODE,
+        .next_sibling = TS_RAD_CST_NO_NODE,
+        .start_point = ts_node_start_point(node),
+        .end_point = ts_node_end_point(node),
+        .flags = flags,
+    };
+}
+
+// The same walk as tree_sitter_rad_flatten in the Go binding, except that
+// it covers the siblings of the first node too.
+uint32_t ts_rad_cst_write_nodes(TSTreeCursor *cursor, TSRadCstNode *nodes, uint32_t first, uint32_t parent,
+                                uint32_t capacity)
+{
+    if (first >= capacity)
+    {
+        return first;
+    }
+    fill(&nodes[first], cursor, parent);
+
+    uint32_t count = first + 1;
+    uint32_t current = first;
+    while (count < capacity)
+    {
+        if (ts_tree_cursor_goto_first_child(cursor))
+        {
+            fill(&nodes[count], cursor, current);
+            nodes[current].first_child = count;
+            current = count++;
+            continue;
+        }
+        for (;;)
+        {
+            if (ts_tree_cursor_goto_next_sibling(cursor))
+            {
+                fill(&nodes[count], cursor, nodes[current].parent);
+                nodes[current].next_sibling = count;
+                current = count++;
+                break;
+            }
+            if (nodes[current].parent == parent || !ts_tree_cursor_goto_parent(cursor))
+            {
+                return count;
+            }
+            current = nodes[current].parent;
+        }
+    }
+    return count;
+}
+
+TSRadCstHeader *ts_rad_cst_new(const TSLanguage *language, const char *source, uint32_t length, uint32_t capacity,
+                               bool embed_source)
+{
+    if (!is_little_endian())
+    {
+        return NULL;
+    }
+    size_t size = sizeof(TSRadCstHeader) + (size_t)capacity * sizeof(TSRadCstNode);
+    TSRadCstHeader *header = calloc(1, size + (embed_source ? length : 0));
+    if (header == NULL)
+    {
+        return NULL;
+    }
+    memcpy(header->magic, "RCST", 4);
+    header->version = TS_RAD_CST_VERSION;
+    header->flags = embed_source ? TS_RAD_CST_EMBEDDED_SOURCE : 0;
+    header->language_version = ts_language_version(language);
+    header->symbol_count = ts_language_symbol_count(language);
+    header->field_count = ts_language_field_count(language);
+    header->state_count = ts_language_state_count(language);
+    header->grammar_hash = tree_sitter_rad_grammar_hash(language);
+    header->source_hash = tree_sitter_rad_source_hash(source, length);
+    header->source_length = length;
+    header->node_size = sizeof(TSRadCstNode);
+    return header;
+}
+
+size_t ts_rad_cst_finish(TSRadCstHeader *header, uint32_t count, const char *source)
+{
+    header->node_count = count;
+    size_t size = sizeof(TSRadCstHeader) + (size_t)count * sizeof(TSRadCstNode);
+    if (header->flags & TS_RAD_CST_EMBEDDED_SOURCE)
+    {
+        memcpy((char *)header + size, source, header->source_length);
+        size += header->source_length;
+    }
+    return size;
+}
+
+size_t tree_sitter_rad_cst_write(const TSTree *tree, const char *source, uint32_t length, bool embed_source,
+                                 void **data)
+{
+    TSNode root = ts_tree_root_node(tree);
+    uint32_t capacity = ts_node_descendant_count(root);
+    TSRadCstHeader *header = ts_rad_cst_new(ts_tree_language(tree), source, length, capacity, embed_source);
+    if (header == NULL)
+    {
+        return 0;
+    }
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    uint32_t count = ts_rad_cst_write_nodes(&cursor, (TSRadCstNode *)(header + 1), 0, TS_RAD_CST_NO_NODE, capacity);
+    ts_tree_cursor_delete(&cursor);
+    *data = header;
+    return ts_rad_cst_finish(header, count, source);
+}
+
+// Checks that every link stays inside the records and follows pre-order, so
+// no walk goes out of bounds or around in a cycle, and that every byte range
+// is within the source.
+static bool nodes_valid(const TSRadCstNode *nodes, uint32_t count, uint32_t source_length)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const TSRadCstNode *node = &nodes[i];
+        bool parent_valid = i == 0 ? node->parent == TS_RAD_CST_NO_NODE : node->parent < i;
+        bool child_valid = node->first_child == TS_RAD_CST_NO_NODE || (node->first_child == i + 1 && i + 1 < count);
+        bool sibling_valid =
+            node->next_sibling == TS_RAD_CST_NO_NODE || (node->next_sibling > i && node->next_sibling < count);
+        if (!parent_valid || !child_valid || !sibling_valid || node->start_byte > node->end_byte ||
+            node->end_byte > source_length)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool tree_sitter_rad_cst_open(TSRadCst *cst, const void *data, size_t size)
+{
+    const TSRadCstHeader *header = data;
+    if (!is_little_endian() || (uintptr_t)data % _Alignof(TSRadCstHeader) != 0 || size < sizeof(TSRadCstHeader) ||
+        memcmp(header->magic, "RCST", 4) != 0 ||
+        header->version != TS_RAD_CST_VERSION || (header->flags & ~TS_RAD_CST_EMBEDDED_SOURCE) != 0 ||
+        header->node_size != sizeof(TSRadCstNode) ||
+        (size - sizeof(TSRadCstHeader)) / sizeof(TSRadCstNode) < header->node_count)
+    {
+        return false;
+    }
+    size_t end = sizeof(TSRadCstHeader) + (size_t)header->node_count * sizeof(TSRadCstNode);
+    bool embedded = header->flags & TS_RAD_CST_EMBEDDED_SOURCE;
+    if ((embedded && size - end < header->source_length) ||
+        !nodes_valid((const TSRadCstNode *)(header + 1), header->node_count, header->source_length))
+    {
+        return false;
+    }
+    cst->header = header;
+    cst->nodes = (const TSRadCstNode *)(header + 1);
+    cst->node_count = header->node_count;
+    cst->source = embedded ? (const char *)data + end : NULL;
+    return true;
+}
+
+bool tree_sitter_rad_cst_matches_language(const TSRadCst *cst, const TSLanguage *language)
+{
+    const TSRadCstHeader *header = cst->header;
+    return header->language_version == ts_language_version(language) &&
+           header->symbol_count == ts_language_symbol_count(language) &&
+           header->field_count == ts_language_field_count(language) &&
+           header->state_count == ts_language_state_count(language) &&
+           header->grammar_hash == tree_sitter_rad_grammar_hash(language);
+}
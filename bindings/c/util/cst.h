@@ -0,0 +1,25 @@
+#ifndef TREE_SITTER_RAD_UTIL_CST_H_
+#define TREE_SITTER_RAD_UTIL_CST_H_
+
+// Building blocks of the CST writers. Not installed.
+
+#include "tree-sitter-rad-util.h"
+
+// Writes the node at `cursor`, the siblings that follow it and all of their
+// descendants to `nodes` in pre-order, from `nodes[first]` on. The nodes at
+// the cursor's level get `parent` as their parent. Returns the index past the
+// last record, which stops at `capacity`.
+uint32_t ts_rad_cst_write_nodes(TSTreeCursor *cursor, TSRadCstNode *nodes, uint32_t first, uint32_t parent,
+                                uint32_t capacity);
+
+// Allocates a CST with room for `capacity` records and fills in its header,
+// apart from the node count. Returns NULL if out of memory or if the host
+// isn't little-endian.
+TSRadCstHeader *ts_rad_cst_new(const TSLanguage *language, const char *source, uint32_t length, uint32_t capacity,
+                               bool embed_source);
+
+// Sets the node count of a CST from ts_rad_cst_new, appends the source if it
+// is embedded, and returns the CST's size.
+size_t ts_rad_cst_finish(TSRadCstHeader *header, uint32_t count, const char *source);
+
+#endif // TREE_SITTER_RAD_UTIL_CST_H_
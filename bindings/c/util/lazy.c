@@ -0,0 +1,383 @@
+#include "tree-sitter-rad-util.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "lazy.h"
+#include "lines.h"
+
+// A skipped body is replaced by one placeholder statement at the body's
+// indentation. The parser sees the source with included ranges that stop
+// after the placeholder and resume at the end of the body, and the input
+// serves the placeholder's bytes in place of the body's first ones, so every
+// node outside the bodies keeps its real offsets.
+
+static const char *const PLACEHOLDERS[] = {
+    [TSRadBodyFunction] = "pass",
+    [TSRadBodyCommand] = "default",
+    [TSRadBodyRad] = "quiet",
+};
+
+static inline bool is_identifier_char(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// Returns whether `line` opens a body that can be skipped, and of what kind:
+// the body has to start on the next line, so the header must end in `:`.
+static bool body_header(const char *source, const RadLine *line, TSRadBodyKind *kind)
+{
+    if (source[line->code_end - 1] != ':')
+    {
+        return false;
+    }
+    uint32_t i;
+    if ((i = ts_rad_line_keyword(source, line, "fn")) != 0 && source[i] == ' ')
+    {
+        *kind = TSRadBodyFunction;
+        return true;
+    }
+    if ((i = ts_rad_line_keyword(source, line, "command")) != 0 && source[i] == ' ')
+    {
+        *kind = TSRadBodyCommand;
+        return true;
+    }
+    if (ts_rad_line_keyword(source, line, "rad") != 0 || ts_rad_line_keyword(source, line, "request") != 0 ||
+        ts_rad_line_keyword(source, line, "display") != 0)
+    {
+        *kind = TSRadBodyRad;
+        return true;
+    }
+    return false;
+}
+
+static TSPoint point_after(const RadLine *line)
+{
+    return line->next > line->end ? (TSPoint){line->row + 1, 0} : (TSPoint){line->row, line->end - line->start};
+}
+
+TSRadLazyTree *ts_rad_lazy_tree_new(const char *source, uint32_t length)
+{
+    TSRadLazyTree *self = calloc(1, sizeof(TSRadLazyTree));
+    if (self != NULL)
+    {
+        self->source = source;
+        self->length = length;
+    }
+    return self;
+}
+
+// Appends `body`, marked to be kept if its placeholder wouldn't fit in it.
+static bool add_body(TSRadLazyTree *self, TSRadBody body, uint32_t indent)
+{
+    const char *keyword = PLACEHOLDERS[body.kind];
+    uint32_t length = indent + (uint32_t)strlen(keyword) + 1;
+    bool keep = length > body.range.end_byte - body.body_byte;
+    if (self->count == self->capacity)
+    {
+        self->capacity = self->capacity ? self->capacity * 2 : 16;
+        TSRadBody *bodies = realloc(self->bodies, self->capacity * sizeof(TSRadBody));
+        if (bodies == NULL)
+        {
+            return false;
+        }
+        self->bodies = bodies;
+        Placeholder *placeholder = realloc(self->placeholder, self->capacity * sizeof(Placeholder));
+        if (placeholder == NULL)
+        {
+            return false;
+        }
+        self->placeholder = placeholder;
+    }
+    char *text = realloc(self->placeholders, self->placeholders_size + length);
+    if (text == NULL)
+    {
+        return false;
+    }
+    self->placeholders = text;
+    text += self->placeholders_size;
+    memset(text, ' ', indent);
+    memcpy(text + indent, keyword, length - indent - 1);
+    text[length - 1] = '\n';
+
+    self->bodies[self->count] = body;
+    self->placeholder[self->count] = (Placeholder){(uint32_t)self->placeholders_size, length, indent, keep};
+    self->count++;
+    self->placeholders_size += length;
+    return true;
+}
+
+bool ts_rad_lazy_tree_find_bodies(TSRadLazyTree *self, uint32_t start, uint32_t row, uint32_t end, uint32_t level,
+                                  unsigned kinds)
+{
+    RadLineScanner scanner;
+    ts_rad_lines_init(&scanner, self->source, end);
+    scanner.offset = start;
+    scanner.row = row;
+
+    // The header of the body being read; once `started`, the body runs to
+    // the last line before the next code at or left of `level`.
+    bool open = false, started = false;
+    TSRadBody body = {0};
+    uint32_t indent = 0;
+    RadLine line, last = {0};
+    while (ts_rad_lines_next(&scanner, &line))
+    {
+        if (!line.logical || line.blank || line.indent > level)
+        {
+            if (open && !started && !line.blank)
+            {
+                // The first line decides the placeholder's indentation.
+                started = line.logical;
+                open = started;
+                indent = line.indent;
+                body.body_byte = line.start;
+                body.body_point = (TSPoint){line.row, 0};
+            }
+            if (open && !line.blank)
+            {
+                last = line;
+            }
+            continue;
+        }
+        if (open && started)
+        {
+            body.range.end_byte = last.next;
+            body.range.end_point = point_after(&last);
+            if (!add_body(self, body, indent))
+            {
+                return false;
+            }
+        }
+        open = line.indent == level && body_header(self->source, &line, &body.kind) &&
+               (kinds & TS_RAD_BODY_KIND(body.kind));
+        started = false;
+        // The header starts at its keyword, so that a nested body parses on
+        // its own without the indentation ahead of it.
+        uint32_t column = 0;
+        while (self->source[line.start + column] == ' ' || self->source[line.start + column] == '\t')
+        {
+            column++;
+        }
+        body.range.start_byte = line.start + column;
+        body.range.start_point = (TSPoint){line.row, column};
+    }
+    if (open && started)
+    {
+        body.range.end_byte = last.next;
+        body.range.end_point = point_after(&last);
+        return add_body(self, body, indent);
+    }
+    return true;
+}
+
+const char *ts_rad_body_name(const TSRadLazyTree *self, uint32_t index, uint32_t *length)
+{
+    const char *text = self->source;
+    uint32_t i = self->bodies[index].range.start_byte;
+    while (is_identifier_char(text[i]))
+    {
+        i++;
+    }
+    while (text[i] == ' ' || text[i] == '\t')
+    {
+        i++;
+    }
+    uint32_t start = i;
+    while (is_identifier_char(text[i]))
+    {
+        i++;
+    }
+    *length = i - start;
+    return text + start;
+}
+
+// Returns the first body whose placeholder ends after `byte`.
+static uint32_t placeholder_search(const TSRadLazyTree *self, uint32_t byte)
+{
+    uint32_t low = 0, high = self->count;
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+        if (self->bodies[mid].body_byte + self->placeholder[mid].length <= byte)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static const char *read_skeleton(void *payload, uint32_t byte_index, TSPoint position, uint32_t *bytes_read)
+{
+    (void)position;
+    const TSRadLazyTree *self = payload;
+    if (byte_index >= self->length)
+    {
+        *bytes_read = 0;
+        return "";
+    }
+    uint32_t i = placeholder_search(self, byte_index);
+    if (i < self->count && byte_index >= self->bodies[i].body_byte)
+    {
+        uint32_t offset = byte_index - self->bodies[i].body_byte;
+        *bytes_read = self->placeholder[i].length - offset;
+        return self->placeholders + self->placeholder[i].text + offset;
+    }
+    uint32_t stop = i < self->count ? self->bodies[i].body_byte : self->length;
+    *bytes_read = stop - byte_index;
+    return self->source + byte_index;
+}
+
+typedef struct
+{
+    uint32_t body_byte;
+    uint32_t index;
+} SortKey;
+
+static int compare_keys(const void *a, const void *b)
+{
+    uint32_t x = ((const SortKey *)a)->body_byte, y = ((const SortKey *)b)->body_byte;
+    return (x > y) - (x < y);
+}
+
+// Drops the bodies marked `keep` and sorts the rest by position.
+static bool compact(TSRadLazyTree *self)
+{
+    size_t capacity = self->count ? self->count : 1;
+    SortKey *keys = malloc(capacity * sizeof(SortKey));
+    TSRadBody *bodies = malloc(capacity * sizeof(TSRadBody));
+    Placeholder *placeholder = malloc(capacity * sizeof(Placeholder));
+    if (keys == NULL || bodies == NULL || placeholder == NULL)
+    {
+        free(keys);
+        free(bodies);
+        free(placeholder);
+        return false;
+    }
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < self->count; i++)
+    {
+        if (!self->placeholder[i].keep)
+        {
+            keys[count++] = (SortKey){self->bodies[i].body_byte, i};
+        }
+    }
+    // Bodies found in one pass come out sorted; only nested finds need this.
+    qsort(keys, count, sizeof(SortKey), compare_keys);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        bodies[i] = self->bodies[keys[i].index];
+        placeholder[i] = self->placeholder[keys[i].index];
+    }
+    free(keys);
+    free(self->bodies);
+    free(self->placeholder);
+    self->bodies = bodies;
+    self->placeholder = placeholder;
+    self->count = self->capacity = count;
+    return true;
+}
+
+bool ts_rad_lazy_tree_parse(TSRadLazyTree *self, TSParser *parser)
+{
+    if (!compact(self))
+    {
+        return false;
+    }
+    TSRange *ranges = malloc(((size_t)self->count + 1) * sizeof(TSRange));
+    if (ranges == NULL)
+    {
+        return false;
+    }
+    TSRange *range = ranges;
+    *range = (TSRange){.start_point = {0, 0}, .start_byte = 0};
+    for (uint32_t i = 0; i < self->count; i++)
+    {
+        const TSRadBody *body = &self->bodies[i];
+        range->end_byte = body->body_byte + self->placeholder[i].length;
+        range->end_point = (TSPoint){body->body_point.row + 1, 0};
+        range++;
+        range->start_byte = body->range.end_byte;
+        range->start_point = body->range.end_point;
+    }
+    range->end_byte = UINT32_MAX;
+    range->end_point = (TSPoint){UINT32_MAX, UINT32_MAX};
+
+    if (ts_parser_set_included_ranges(parser, ranges, self->count + 1))
+    {
+        TSInput input = {.payload = self, .read = read_skeleton, .encoding = TSInputEncodingUTF8};
+        self->skeleton = ts_parser_parse(parser, NULL, input);
+        ts_parser_set_included_ranges(parser, NULL, 0);
+    }
+    free(ranges);
+    return self->skeleton != NULL;
+}
+
+TSRadLazyTree *tree_sitter_rad_parse_lazy(TSParser *parser, const char *source, uint32_t length)
+{
+    TSRadLazyTree *self = ts_rad_lazy_tree_new(source, length);
+    if (self == NULL)
+    {
+        return NULL;
+    }
+    if (!ts_rad_lazy_tree_find_bodies(self, 0, 0, length, 0, TS_RAD_ALL_BODY_KINDS) ||
+        !ts_rad_lazy_tree_parse(self, parser))
+    {
+        tree_sitter_rad_lazy_tree_delete(self);
+        return NULL;
+    }
+    return self;
+}
+
+void tree_sitter_rad_lazy_tree_delete(TSRadLazyTree *self)
+{
+    if (self->skeleton != NULL)
+    {
+        ts_tree_delete(self->skeleton);
+    }
+    free(self->bodies);
+    free(self->placeholder);
+    free(self->placeholders);
+    free(self);
+}
+
+const TSTree *tree_sitter_rad_lazy_tree_skeleton(const TSRadLazyTree *self) { return self->skeleton; }
+
+const TSRadBody *tree_sitter_rad_lazy_tree_bodies(const TSRadLazyTree *self, uint32_t *count)
+{
+    *count = self->count;
+    return self->bodies;
+}
+
+uint32_t tree_sitter_rad_lazy_tree_body_at(const TSRadLazyTree *self, uint32_t byte)
+{
+    uint32_t low = 0, high = self->count;
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+        if (self->bodies[mid].range.end_byte <= byte)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low < self->count && byte >= self->bodies[low].body_byte ? low : UINT32_MAX;
+}
+
+TSTree *tree_sitter_rad_parse_body(TSParser *parser, const TSRadLazyTree *self, uint32_t index)
+{
+    if (index >= self->count || !ts_parser_set_included_ranges(parser, &self->bodies[index].range, 1))
+    {
+        return NULL;
+    }
+    TSTree *tree = ts_parser_parse_string(parser, NULL, self->source, self->length);
+    ts_parser_set_included_ranges(parser, NULL, 0);
+    return tree;
+}
@@ -0,0 +1,51 @@
+#ifndef TREE_SITTER_RAD_UTIL_LAZY_H_
+#define TREE_SITTER_RAD_UTIL_LAZY_H_
+
+// Internals of TSRadLazyTree shared by the lazy and command parses. Not
+// installed.
+
+#include "tree-sitter-rad-util.h"
+
+#include <stdbool.h>
+
+typedef struct
+{
+    uint32_t text;   // Offset of the placeholder in TSRadLazyTree.placeholders.
+    uint32_t length; // Placeholder length, counted from body_byte.
+    uint32_t indent; // Width of the body's indentation.
+    bool keep;       // Parse this body after all; dropped by ts_rad_lazy_tree_parse.
+} Placeholder;
+
+struct TSRadLazyTree
+{
+    const char *source;
+    uint32_t length;
+    TSTree *skeleton;
+    TSRadBody *bodies;
+    Placeholder *placeholder;
+    uint32_t count;
+    uint32_t capacity;
+    char *placeholders;
+    size_t placeholders_size;
+};
+
+#define TS_RAD_BODY_KIND(kind) (1u << (kind))
+#define TS_RAD_ALL_BODY_KINDS                                                                                    \
+    (TS_RAD_BODY_KIND(TSRadBodyFunction) | TS_RAD_BODY_KIND(TSRadBodyCommand) | TS_RAD_BODY_KIND(TSRadBodyRad))
+
+TSRadLazyTree *ts_rad_lazy_tree_new(const char *source, uint32_t length);
+
+// Appends the bodies of the given kinds whose headers sit at indentation
+// `level` between `start`, which must be a logical line start on `row`, and
+// `end`. Returns false if out of memory.
+bool ts_rad_lazy_tree_find_bodies(TSRadLazyTree *self, uint32_t start, uint32_t row, uint32_t end, uint32_t level,
+                                  unsigned kinds);
+
+// Returns the name a body's header declares, e.g. `f` for `fn f():`.
+const char *ts_rad_body_name(const TSRadLazyTree *self, uint32_t index, uint32_t *length);
+
+// Drops the bodies marked `keep`, sorts the rest and parses the skeleton.
+// Returns false if the parse fails.
+bool ts_rad_lazy_tree_parse(TSRadLazyTree *self, TSParser *parser);
+
+#endif // TREE_SITTER_RAD_UTIL_LAZY_H_
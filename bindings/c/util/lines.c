@@ -0,0 +1,287 @@
+#include "lines.h"
+
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// This is a rough lexer: it knows where strings, comments and brackets are
+// but nothing else. When it gets a line wrong it errs towards calling it
+// not logical, which makes callers treat the line as part of whatever came
+// before it.
+
+void ts_rad_lines_init(RadLineScanner *scanner, const char *source, uint32_t length)
+{
+    *scanner = (RadLineScanner){
+        .source = source,
+        .length = length,
+        .classify = ts_rad_prelex_kernel(TSRadScanKernelBest),
+        .block = UINT32_MAX,
+    };
+}
+
+static inline uint32_t lowest_bit(uint64_t bits)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return (uint32_t)index;
+#else
+    return (uint32_t)__builtin_ctzll(bits);
+#endif
+}
+
+// Returns the first line break, or the first special if `newline` is false,
+// in [i, end), or `end` if there is none. Lines are scanned forwards, so
+// each block is classified about once.
+static uint32_t find(RadLineScanner *scanner, uint32_t i, uint32_t end, bool newline)
+{
+    while (i < end)
+    {
+        uint32_t block = i / 64;
+        if (block != scanner->block)
+        {
+            uint32_t offset = block * 64;
+            if (scanner->length - offset >= 64)
+            {
+                scanner->mask = scanner->classify(scanner->source + offset);
+            }
+            else
+            {
+                char tail[64] = {0};
+                memcpy(tail, scanner->source + offset, scanner->length - offset);
+                scanner->mask = scanner->classify(tail);
+            }
+            scanner->block = block;
+        }
+        uint64_t bits = (newline ? scanner->mask.newlines : scanner->mask.specials) >> (i % 64);
+        if (bits != 0)
+        {
+            i += lowest_bit(bits);
+            return i < end ? i : end;
+        }
+        i = (block + 1) * 64;
+    }
+    return end;
+}
+
+static inline bool is_space(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+// Whether text[i, end) is `---` with optional trailing whitespace.
+static bool is_fence(const char *text, uint32_t i, uint32_t end)
+{
+    if (end - i < 3 || memcmp(text + i, "---", 3) != 0)
+    {
+        return false;
+    }
+    for (i += 3; i < end; i++)
+    {
+        if (!is_space(text[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static inline bool is_triple_quote(const char *text, uint32_t i, uint32_t end)
+{
+    return i + 2 < end && text[i] == '"' && text[i + 1] == '"' && text[i + 2] == '"';
+}
+
+// Returns the index just past the closing `quote` of a one-line string that
+// opened before `i`, or `end` if the line ends first.
+static uint32_t skip_string(RadLineScanner *scanner, uint32_t i, uint32_t end, char quote)
+{
+    const char *text = scanner->source;
+    while ((i = find(scanner, i, end, false)) < end)
+    {
+        if (text[i] == '\\')
+        {
+            i += 2;
+            continue;
+        }
+        if (text[i++] == quote)
+        {
+            return i;
+        }
+    }
+    return end;
+}
+
+bool ts_rad_lines_next(RadLineScanner *scanner, RadLine *line)
+{
+    if (scanner->offset >= scanner->length)
+    {
+        return false;
+    }
+    const char *text = scanner->source;
+    uint32_t start = scanner->offset;
+    uint32_t end = find(scanner, start, scanner->length, true);
+
+    *line = (RadLine){
+        .start = start,
+        .end = end,
+        .next = end < scanner->length ? end + 1 : end,
+        .code_end = start,
+        .row = scanner->row,
+        .logical = !scanner->in_triple_string && !scanner->in_text && scanner->depth == 0 && !scanner->continued,
+    };
+    scanner->offset = line->next;
+    scanner->row++;
+
+    uint32_t i = start;
+    for (; i < end && (text[i] == ' ' || text[i] == '\t'); i++)
+    {
+        line->indent += text[i] == '\t' ? 8 : 1;
+    }
+
+    // Header and description text is free-form, so none of it is lexed.
+    if (scanner->in_text || (line->logical && is_fence(text, i, end)))
+    {
+        line->fence = !scanner->in_text;
+        scanner->in_text = scanner->in_text ? !is_fence(text, i, end) : true;
+        line->code_end = end;
+        return true;
+    }
+    if (scanner->in_triple_string)
+    {
+        i = start;
+    }
+
+    bool has_code = false;
+    while (i < end)
+    {
+        if (scanner->in_triple_string)
+        {
+            while ((i = find(scanner, i, end, false)) < end && !is_triple_quote(text, i, end))
+            {
+                i++;
+            }
+            if (i == end)
+            {
+                line->code_end = end;
+                break;
+            }
+            scanner->in_triple_string = false;
+            i += 3;
+            line->code_end = i;
+            has_code = true;
+            continue;
+        }
+
+        // Up to the next special there are only identifiers, operators and
+        // whitespace.
+        uint32_t special = find(scanner, i, end, false), code_end = special;
+        while (code_end > i && is_space(text[code_end - 1]))
+        {
+            code_end--;
+        }
+        if (code_end > i)
+        {
+            line->code_end = code_end;
+            has_code = true;
+        }
+        i = special;
+        if (i == end)
+        {
+            break;
+        }
+
+        char c = text[i];
+        if (c == '#' || (c == '/' && i + 1 < end && text[i + 1] == '/'))
+        {
+            break;
+        }
+        if (c == '"' && is_triple_quote(text, i, end))
+        {
+            scanner->in_triple_string = true;
+            i += 3;
+        }
+        else if (c == '"' || c == '\'' || c == '`')
+        {
+            i = skip_string(scanner, i + 1, end, c);
+        }
+        else
+        {
+            if (c == '(' || c == '[' || c == '{')
+            {
+                scanner->depth++;
+            }
+            else if ((c == ')' || c == ']' || c == '}') && scanner->depth > 0)
+            {
+                scanner->depth--;
+            }
+            i++;
+        }
+        line->code_end = i;
+        has_code = true;
+    }
+
+    line->blank = line->logical && !has_code;
+    scanner->continued = !scanner->in_triple_string && has_code && text[line->code_end - 1] == '\\';
+    return true;
+}
+
+bool ts_rad_line_opens_block(const char *source, const RadLine *line, uint32_t i)
+{
+    while (i < line->code_end && (source[i] == ' ' || source[i] == '\t'))
+    {
+        i++;
+    }
+    return i + 1 == line->code_end && source[i] == ':';
+}
+
+uint32_t ts_rad_line_keyword(const char *source, const RadLine *line, const char *keyword)
+{
+    uint32_t start = line->start, n = (uint32_t)strlen(keyword);
+    while (start < line->code_end && (source[start] == ' ' || source[start] == '\t'))
+    {
+        start++;
+    }
+    if (line->code_end - start < n || memcmp(source + start, keyword, n) != 0)
+    {
+        return 0;
+    }
+    char next = start + n < line->code_end ? source[start + n] : ' ';
+    bool identifier = (next >= 'a' && next <= 'z') || (next >= 'A' && next <= 'Z') || (next >= '0' && next <= '9') ||
+                      next == '_';
+    return identifier ? 0 : start + n;
+}
+
+bool ts_rad_line_starts_statement(const char *source, const RadLine *line, const RadLine *previous)
+{
+    return line->logical && line->indent == 0 && previous->logical && source[previous->code_end - 1] != ':' &&
+           ts_rad_line_keyword(source, line, "else") == 0 && ts_rad_line_keyword(source, line, "catch") == 0;
+}
+
+uint32_t tree_sitter_rad_scan_lines(const char *source, uint32_t length, TSRadScanKernel kernel, TSRadLine *lines,
+                                    uint32_t capacity)
+{
+    RadLineScanner scanner;
+    ts_rad_lines_init(&scanner, source, length);
+    RadClassify classify = ts_rad_prelex_kernel(kernel);
+    if (classify != NULL)
+    {
+        scanner.classify = classify;
+    }
+
+    uint32_t count = 0;
+    RadLine line;
+    while (ts_rad_lines_next(&scanner, &line))
+    {
+        if (count < capacity)
+        {
+            lines[count] = (TSRadLine){
+                .start_byte = line.start,
+                .code_end_byte = line.code_end,
+                .indent = line.indent,
+                .flags = (line.blank ? TS_RAD_LINE_BLANK : 0) | (line.logical ? TS_RAD_LINE_LOGICAL : 0) |
+                         (line.fence ? TS_RAD_LINE_FENCE : 0),
+            };
+        }
+        count++;
+    }
+    return count;
+}
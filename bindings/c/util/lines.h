@@ -0,0 +1,57 @@
+#ifndef TREE_SITTER_RAD_UTIL_LINES_H_
+#define TREE_SITTER_RAD_UTIL_LINES_H_
+
+// Line-level structure of a Rad source, for the helpers that split or skip
+// parts of a script without parsing it. Not installed.
+
+#include "prelex.h"
+
+typedef struct
+{
+    uint32_t start;    // First byte of the line.
+    uint32_t end;      // The line break, or the end of input.
+    uint32_t next;     // First byte of the following line.
+    uint32_t code_end; // End of the line's code, before trailing whitespace and comments.
+    uint32_t row;
+    uint32_t indent;   // Width of the leading whitespace; tabs count 8, as in scanner.c.
+    bool blank;        // No code, only whitespace and comments.
+    bool logical;      // Starts outside any string, bracket, `---` text or backslash continuation.
+    bool fence;        // Opens a file header or command description.
+} RadLine;
+
+typedef struct
+{
+    const char *source;
+    uint32_t length;
+    uint32_t offset;
+    uint32_t row;
+    uint32_t depth; // Open brackets.
+    bool in_triple_string;
+    bool in_text; // Between the `---` fences of a file header or command description.
+    bool continued;
+    // The last block classified, by index.
+    RadClassify classify;
+    uint32_t block;
+    RadBlockMask mask;
+} RadLineScanner;
+
+// Starts scanning `source` with the best kernel this machine supports.
+void ts_rad_lines_init(RadLineScanner *scanner, const char *source, uint32_t length);
+
+// Reads the next line into `line`. Returns false at the end of input.
+bool ts_rad_lines_next(RadLineScanner *scanner, RadLine *line);
+
+// If the code of `line` starts with `keyword` followed by a non-identifier
+// byte, returns the offset just past the keyword; otherwise 0.
+uint32_t ts_rad_line_keyword(const char *source, const RadLine *line, const char *keyword);
+
+// Whether `line` starts a top-level statement, given the last code line
+// before it. Parsing may start at such a line: the external scanner has
+// nothing on its indent stack there, and the newline and dedent tokens that
+// end the previous statement are zero-width at the end of its last line.
+bool ts_rad_line_starts_statement(const char *source, const RadLine *line, const RadLine *previous);
+
+// Whether the code of `line` from `i` on is just the `:` that opens a block.
+bool ts_rad_line_opens_block(const char *source, const RadLine *line, uint32_t i);
+
+#endif // TREE_SITTER_RAD_UTIL_LINES_H_
@@ -0,0 +1,176 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "tree-sitter-rad-util.h"
+
+#include <errno.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+int tree_sitter_rad_map_file(TSRadMappedFile *file, const char *path)
+{
+    *file = (TSRadMappedFile){.data = "", .length = 0, .handle = NULL};
+
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        DWORD code = GetLastError();
+        return code == ERROR_FILE_NOT_FOUND || code == ERROR_PATH_NOT_FOUND ? ENOENT : EIO;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size))
+    {
+        CloseHandle(handle);
+        return EIO;
+    }
+    if (size.QuadPart > UINT32_MAX)
+    {
+        CloseHandle(handle);
+        return EFBIG;
+    }
+    if (size.QuadPart == 0)
+    {
+        // Windows refuses to map empty files.
+        CloseHandle(handle);
+        return 0;
+    }
+
+    // The view keeps the mapping alive, and the mapping the file.
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);
+    if (mapping == NULL)
+    {
+        return EIO;
+    }
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == NULL)
+    {
+        return ENOMEM;
+    }
+    file->data = view;
+    file->length = (size_t)size.QuadPart;
+    file->handle = (void *)view;
+    return 0;
+}
+
+void tree_sitter_rad_unmap_file(TSRadMappedFile *file)
+{
+    if (file->handle != NULL)
+    {
+        UnmapViewOfFile(file->handle);
+    }
+    *file = (TSRadMappedFile){.data = "", .length = 0, .handle = NULL};
+}
+
+#else
+
+int tree_sitter_rad_map_file(TSRadMappedFile *file, const char *path)
+{
+    *file = (TSRadMappedFile){.data = "", .length = 0, .handle = NULL};
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return errno;
+    }
+    struct stat info;
+    if (fstat(fd, &info) < 0)
+    {
+        int error = errno;
+        close(fd);
+        return error;
+    }
+    if ((uintmax_t)info.st_size > UINT32_MAX)
+    {
+        close(fd);
+        return EFBIG;
+    }
+    if (info.st_size == 0)
+    {
+        // mmap rejects a zero length.
+        close(fd);
+        return 0;
+    }
+
+    void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    int error = errno;
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        return error;
+    }
+    // The lexer reads front to back, so ask for aggressive readahead.
+    posix_madvise(data, (size_t)info.st_size, POSIX_MADV_SEQUENTIAL);
+
+    file->data = data;
+    file->length = (size_t)info.st_size;
+    file->handle = data;
+    return 0;
+}
+
+void tree_sitter_rad_unmap_file(TSRadMappedFile *file)
+{
+    if (file->handle != NULL)
+    {
+        munmap(file->handle, file->length);
+    }
+    *file = (TSRadMappedFile){.data = "", .length = 0, .handle = NULL};
+}
+
+#endif
+
+static const char *read_mapping(void *payload, uint32_t byte_index, TSPoint position, uint32_t *bytes_read)
+{
+    (void)position;
+    const TSRadMappedFile *file = payload;
+    if (byte_index >= file->length)
+    {
+        *bytes_read = 0;
+        return "";
+    }
+    // The whole remainder is one chunk: the lexer only ever looks at the
+    // bytes it is given, so there is no reason to slice the mapping up.
+    *bytes_read = (uint32_t)(file->length - byte_index);
+    return file->data + byte_index;
+}
+
+TSInput tree_sitter_rad_mapped_input(const TSRadMappedFile *file)
+{
+    return (TSInput){
+        .payload = (void *)file,
+        .read = read_mapping,
+        .encoding = TSInputEncodingUTF8,
+    };
+}
+
+TSTree *tree_sitter_rad_parse_file(TSParser *parser, const char *path, TSRadMappedFile *file, int *error)
+{
+    int status = tree_sitter_rad_map_file(file, path);
+    if (error != NULL)
+    {
+        *error = status;
+    }
+    if (status != 0)
+    {
+        return NULL;
+    }
+    TSTree *tree = ts_parser_parse(parser, NULL, tree_sitter_rad_mapped_input(file));
+    if (tree == NULL)
+    {
+        tree_sitter_rad_unmap_file(file);
+    }
+    return tree;
+}
@@ -0,0 +1,86 @@
+#include "tree-sitter-rad-util.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "lines.h"
+
+// The preamble is everything source_file allows before its statements: a
+// shebang, the `---` file header, the `args:` block and `command` blocks,
+// plus the blank and comment lines around them. Its end is found line by
+// line, without parsing.
+
+static inline bool is_space(char c) { return c == ' ' || c == '\t'; }
+
+static inline bool is_identifier_char(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static bool is_args_line(const char *source, const RadLine *line)
+{
+    uint32_t i = ts_rad_line_keyword(source, line, "args");
+    return i != 0 && ts_rad_line_opens_block(source, line, i);
+}
+
+static bool is_command_line(const char *source, const RadLine *line)
+{
+    uint32_t i = ts_rad_line_keyword(source, line, "command");
+    if (i == 0 || i == line->code_end || !is_space(source[i]))
+    {
+        return false;
+    }
+    while (i < line->code_end && is_space(source[i]))
+    {
+        i++;
+    }
+    uint32_t name = i;
+    while (i < line->code_end && is_identifier_char(source[i]))
+    {
+        i++;
+    }
+    return i > name && ts_rad_line_opens_block(source, line, i);
+}
+
+uint32_t tree_sitter_rad_preamble_length(const char *source, uint32_t length)
+{
+    RadLineScanner scanner;
+    ts_rad_lines_init(&scanner, source, length);
+
+    // What may still follow, in source_file's order.
+    bool header_allowed = true, args_allowed = true, in_block = false;
+    RadLine line;
+    while (ts_rad_lines_next(&scanner, &line))
+    {
+        // Lines that aren't logical continue whatever the last one started,
+        // and the shebang lexes as a comment.
+        if (!line.logical || line.blank || (in_block && line.indent > 0))
+        {
+            continue;
+        }
+        if (header_allowed && line.fence)
+        {
+            // The scanner has skipped to the closing fence, or to the end if
+            // there is none, in which case the full parse reports it.
+            header_allowed = false;
+        }
+        else if ((args_allowed && is_args_line(source, &line)) || is_command_line(source, &line))
+        {
+            header_allowed = args_allowed = false;
+            in_block = true;
+        }
+        else
+        {
+            // The first statement.
+            return line.start;
+        }
+    }
+    return length;
+}
+
+TSTree *tree_sitter_rad_parse_preamble(TSParser *parser, const char *source, uint32_t length)
+{
+    // The scanner closes any open blocks at the end of input, so parsing the
+    // prefix yields exactly the preamble's nodes at their real offsets.
+    return ts_parser_parse_string(parser, NULL, source, tree_sitter_rad_preamble_length(source, length));
+}
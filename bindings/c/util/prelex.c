@@ -0,0 +1,126 @@
+#include "prelex.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define PRELEX_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// AVX2 is picked at run time, so it needs a compiler that can target it one
+// function at a time.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PRELEX_AVX2 1
+#include <immintrin.h>
+#endif
+
+// The specials are what ts_rad_lines_next acts on: the three quotes, the
+// backslash that escapes them, the brackets, and `#` and `/`, either of
+// which may start a comment.
+static const uint8_t SPECIAL[256] = {
+    ['"'] = 1, ['\''] = 1, ['`'] = 1, ['\\'] = 1, ['#'] = 1, ['/'] = 1,
+    ['('] = 1, [')'] = 1,  ['['] = 1, [']'] = 1,  ['{'] = 1, ['}'] = 1,
+};
+
+static RadBlockMask classify_scalar(const char *block)
+{
+    RadBlockMask mask = {0, 0};
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        uint8_t c = (uint8_t)block[i];
+        mask.newlines |= (uint64_t)(c == '\n') << i;
+        mask.specials |= (uint64_t)SPECIAL[c] << i;
+    }
+    return mask;
+}
+
+#ifdef PRELEX_SSE2
+
+static RadBlockMask classify_sse2(const char *block)
+{
+    RadBlockMask mask = {0, 0};
+    for (uint32_t k = 0; k < 4; k++)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(block + 16 * k));
+        // `(` and `)` differ only in the low bit.
+        __m128i special = _mm_cmpeq_epi8(_mm_or_si128(v, _mm_set1_epi8(1)), _mm_set1_epi8(')'));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('`')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('#')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('/')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('[')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8(']')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('{')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(v, _mm_set1_epi8('}')));
+        __m128i newline = _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'));
+        mask.specials |= (uint64_t)(uint16_t)_mm_movemask_epi8(special) << (16 * k);
+        mask.newlines |= (uint64_t)(uint16_t)_mm_movemask_epi8(newline) << (16 * k);
+    }
+    return mask;
+}
+
+#endif
+
+#ifdef PRELEX_AVX2
+
+// A byte is special when the entries for its low and high nibbles share a
+// bit: bit 0 for `"#'()/`, all 0x2_, bit 1 for `[]{}`, 0x5_ and 0x7_, bit 2
+// for the backtick and bit 3 for the backslash.
+__attribute__((target("avx2"))) static RadBlockMask classify_avx2(const char *block)
+{
+    const __m256i low_table = _mm256_setr_epi8(4, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 2, 8, 2, 0, 1, //
+                                               4, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 2, 8, 2, 0, 1);
+    const __m256i high_table = _mm256_setr_epi8(0, 0, 1, 0, 0, 10, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                                0, 0, 1, 0, 0, 10, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    RadBlockMask mask = {0, 0};
+    for (uint32_t k = 0; k < 2; k++)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(block + 32 * k));
+        __m256i low = _mm256_shuffle_epi8(low_table, _mm256_and_si256(v, nibble));
+        __m256i high = _mm256_shuffle_epi8(high_table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+        __m256i plain = _mm256_cmpeq_epi8(_mm256_and_si256(low, high), _mm256_setzero_si256());
+        __m256i newline = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'));
+        mask.specials |= (uint64_t)(uint32_t)~_mm256_movemask_epi8(plain) << (32 * k);
+        mask.newlines |= (uint64_t)(uint32_t)_mm256_movemask_epi8(newline) << (32 * k);
+    }
+    return mask;
+}
+
+#endif
+
+RadClassify ts_rad_prelex_kernel(TSRadScanKernel kernel)
+{
+    switch (kernel)
+    {
+    case TSRadScanKernelBest:
+#ifdef PRELEX_AVX2
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return classify_avx2;
+        }
+#endif
+#ifdef PRELEX_SSE2
+        return classify_sse2;
+#else
+        return classify_scalar;
+#endif
+    case TSRadScanKernelScalar:
+        return classify_scalar;
+    case TSRadScanKernelSSE2:
+#ifdef PRELEX_SSE2
+        return classify_sse2;
+#else
+        return NULL;
+#endif
+    case TSRadScanKernelAVX2:
+#ifdef PRELEX_AVX2
+        return __builtin_cpu_supports("avx2") ? classify_avx2 : NULL;
+#else
+        return NULL;
+#endif
+    }
+    return NULL;
+}
+
+bool tree_sitter_rad_scan_kernel_supported(TSRadScanKernel kernel) { return ts_rad_prelex_kernel(kernel) != NULL; }
@@ -0,0 +1,23 @@
+#ifndef TREE_SITTER_RAD_UTIL_PRELEX_H_
+#define TREE_SITTER_RAD_UTIL_PRELEX_H_
+
+// Vectorized classification of source bytes for the line scanner. Not
+// installed.
+
+#include "tree-sitter-rad-util.h"
+
+// Bit i of each mask stands for byte i of a 64-byte block.
+typedef struct
+{
+    uint64_t newlines;
+    // Bytes the line scanner has to look at: quotes, backslashes, brackets
+    // and the starts of comments.
+    uint64_t specials;
+} RadBlockMask;
+
+typedef RadBlockMask (*RadClassify)(const char *block);
+
+// Returns the kernel for `kernel`, or NULL if this machine can't run it.
+RadClassify ts_rad_prelex_kernel(TSRadScanKernel kernel);
+
+#endif // TREE_SITTER_RAD_UTIL_PRELEX_H_
@@ -0,0 +1,317 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "tree-sitter-rad-util.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "lines.h"
+
+// The stream keeps the bytes from the first unreleased one to the last one
+// read in one buffer, so the line scanner and the lexer both use them in
+// place. Released bytes are dropped when the buffer runs out of room, before
+// it is grown, so a caller that releases what it has run needs room for
+// little more than the statements in flight.
+
+#define DEFAULT_CHUNK_SIZE (64 * 1024)
+
+struct TSRadStream
+{
+    int fd;
+    uint32_t chunk_size;
+    // Bytes [base, length) of the input, in a buffer of `capacity` bytes.
+    char *data;
+    uint32_t base;
+    uint32_t length;
+    uint32_t capacity;
+    uint32_t released;
+    bool eof;
+    int error;
+
+    // Where the next part to parse starts, and its row.
+    uint32_t position;
+    uint32_t row;
+    bool preamble_done;
+    // The lexer is given nothing from here on.
+    uint32_t limit;
+};
+
+TSRadStream *tree_sitter_rad_stream_new(int fd, uint32_t chunk_size)
+{
+    TSRadStream *self = calloc(1, sizeof(TSRadStream));
+    if (self == NULL)
+    {
+        return NULL;
+    }
+    self->fd = fd;
+    self->chunk_size = chunk_size > 0 ? chunk_size : DEFAULT_CHUNK_SIZE;
+    self->limit = UINT32_MAX;
+    return self;
+}
+
+void tree_sitter_rad_stream_delete(TSRadStream *self)
+{
+    if (self != NULL)
+    {
+        free(self->data);
+        free(self);
+    }
+}
+
+int tree_sitter_rad_stream_error(const TSRadStream *self) { return self->error; }
+
+// Makes room for a chunk after the last byte read.
+static bool reserve(TSRadStream *self)
+{
+    uint32_t kept = self->length - self->base;
+    if (self->capacity - kept >= self->chunk_size)
+    {
+        return true;
+    }
+    if (self->released > self->base)
+    {
+        memmove(self->data, self->data + (self->released - self->base), self->length - self->released);
+        kept = self->length - self->released;
+        self->base = self->released;
+        if (self->capacity - kept >= self->chunk_size)
+        {
+            return true;
+        }
+    }
+    uint64_t capacity = (uint64_t)self->capacity * 2;
+    if (capacity < (uint64_t)kept + self->chunk_size)
+    {
+        capacity = (uint64_t)kept + self->chunk_size;
+    }
+    char *data = capacity <= UINT32_MAX ? realloc(self->data, capacity) : NULL;
+    if (data == NULL)
+    {
+        self->error = ENOMEM;
+        return false;
+    }
+    self->data = data;
+    self->capacity = (uint32_t)capacity;
+    return true;
+}
+
+// Reads whatever has arrived, up to a chunk, waiting if nothing has. Returns
+// false at the end of input or on an error.
+static bool read_more(TSRadStream *self)
+{
+    if (self->eof)
+    {
+        return false;
+    }
+    if (UINT32_MAX - self->length < self->chunk_size)
+    {
+        // Offsets wouldn't fit in a uint32_t.
+        self->error = EFBIG;
+    }
+    else if (reserve(self))
+    {
+        for (;;)
+        {
+#ifdef _WIN32
+            int count = _read(self->fd, self->data + (self->length - self->base), self->chunk_size);
+#else
+            ssize_t count = read(self->fd, self->data + (self->length - self->base), self->chunk_size);
+#endif
+            if (count > 0)
+            {
+                self->length += (uint32_t)count;
+                return true;
+            }
+            if (count == 0)
+            {
+                break;
+            }
+            if (errno != EINTR)
+            {
+                self->error = errno;
+                break;
+            }
+        }
+    }
+    self->eof = true;
+    return false;
+}
+
+static const char *read_stream(void *payload, uint32_t byte_index, TSPoint position, uint32_t *bytes_read)
+{
+    (void)position;
+    TSRadStream *self = payload;
+    while (byte_index >= self->length && byte_index < self->limit && read_more(self))
+    {
+    }
+    if (byte_index < self->base || byte_index >= self->length || byte_index >= self->limit)
+    {
+        *bytes_read = 0;
+        return "";
+    }
+    uint32_t end = self->length < self->limit ? self->length : self->limit;
+    *bytes_read = end - byte_index;
+    return self->data + (byte_index - self->base);
+}
+
+TSInput tree_sitter_rad_stream_input(TSRadStream *self)
+{
+    return (TSInput){
+        .payload = self,
+        .read = read_stream,
+        .encoding = TSInputEncodingUTF8,
+    };
+}
+
+const char *tree_sitter_rad_stream_text(const TSRadStream *self, uint32_t byte, uint32_t *length)
+{
+    if (byte < self->base || byte > self->length)
+    {
+        *length = 0;
+        return NULL;
+    }
+    *length = self->length - byte;
+    return self->data + (byte - self->base);
+}
+
+void tree_sitter_rad_stream_release(TSRadStream *self, uint32_t byte)
+{
+    // The next parse starts at `position`, so everything from there is kept.
+    if (byte > self->position)
+    {
+        byte = self->position;
+    }
+    if (byte > self->released)
+    {
+        self->released = byte;
+    }
+}
+
+// Points `scanner` at the bytes from `position` on, after a read may have
+// moved them. A tail block classified before the read has changed too.
+static void rescan_from(const TSRadStream *self, RadLineScanner *scanner)
+{
+    scanner->source = self->data + (self->position - self->base);
+    scanner->length = self->length - self->position;
+    scanner->block = UINT32_MAX;
+}
+
+// Reads until the preamble has arrived. Returns its end, which is
+// `position` if the script has none.
+static uint32_t preamble_end(TSRadStream *self, uint32_t *row)
+{
+    for (;;)
+    {
+        const char *text = self->data + (self->position - self->base);
+        uint32_t available = self->length - self->position;
+        uint32_t length = tree_sitter_rad_preamble_length(text, available);
+        // The line that ends the preamble has to be whole to be told apart
+        // from a preamble line.
+        if (self->eof || (length < available && memchr(text + length, '\n', available - length) != NULL))
+        {
+            for (const char *newline = text; (newline = memchr(newline, '\n', text + length - newline)) != NULL;
+                 newline++)
+            {
+                (*row)++;
+            }
+            return self->position + length;
+        }
+        read_more(self);
+    }
+}
+
+// Reads until at least one whole top-level statement has arrived, or the
+// input has ended. Returns where the statements that have arrived end.
+static uint32_t statements_end(TSRadStream *self, uint32_t *row)
+{
+    RadLineScanner scanner;
+    ts_rad_lines_init(&scanner, "", 0);
+    rescan_from(self, &scanner);
+    RadLine line, previous = {.logical = false};
+    uint32_t end = 0, end_row = 0;
+    for (;;)
+    {
+        RadLineScanner saved = scanner;
+        bool more = ts_rad_lines_next(&scanner, &line);
+        if (more && (line.end < scanner.length || self->eof))
+        {
+            if (!line.blank)
+            {
+                if (line.start > 0 && ts_rad_line_starts_statement(scanner.source, &line, &previous))
+                {
+                    end = line.start;
+                    end_row = line.row;
+                }
+                previous = line;
+            }
+            continue;
+        }
+        if (end > 0)
+        {
+            // The statement after `end` may go on past what has arrived.
+            *row += end_row;
+            return self->position + end;
+        }
+        if (!read_more(self) && !more)
+        {
+            return self->length;
+        }
+        // The line cut short by the end of what had arrived is scanned
+        // again once more has.
+        scanner = saved;
+        rescan_from(self, &scanner);
+    }
+}
+
+TSTree *tree_sitter_rad_stream_parse_next(TSRadStream *self, TSParser *parser)
+{
+    if (self->position == self->length && !read_more(self))
+    {
+        return NULL;
+    }
+
+    uint32_t row = self->row, end = self->position;
+    if (!self->preamble_done)
+    {
+        end = preamble_end(self, &row);
+        self->preamble_done = true;
+    }
+    if (end == self->position)
+    {
+        end = statements_end(self, &row);
+    }
+
+    TSRange range = {
+        .start_point = {self->row, 0},
+        .end_point = {row, 0},
+        .start_byte = self->position,
+        .end_byte = end,
+    };
+    if (self->eof && end == self->length)
+    {
+        range.end_point = (TSPoint){UINT32_MAX, UINT32_MAX};
+        range.end_byte = UINT32_MAX;
+    }
+    TSTree *tree = NULL;
+    if (ts_parser_set_included_ranges(parser, &range, 1))
+    {
+        self->limit = end;
+        tree = ts_parser_parse(parser, NULL, tree_sitter_rad_stream_input(self));
+        self->limit = UINT32_MAX;
+        ts_parser_set_included_ranges(parser, NULL, 0);
+    }
+    if (tree != NULL)
+    {
+        self->position = end;
+        self->row = row;
+    }
+    return tree;
+}
@@ -0,0 +1,204 @@
+package tree_sitter_rad_test
+
+import (
+	"bytes"
+	"context"
+	"fmt"
+	"io/fs"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	tree_sitter_rad "github.com/amterp/tree-sitter-rad/bindings/go"
+	"github.com/amterp/tree-sitter-rad/bindings/go/pool"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+// Benchmarks for comparing grammar releases, e.g.
+//
+//	go test ./bindings/go -run '^$' -bench . -cpu 1,4,16 > old.txt
+//	benchstat old.txt new.txt
+//
+// Besides ns/op they report MB/s, allocs/op and nodes/s. The parallel
+// benchmark parses every script under RAD_BENCH_CORPUS, which defaults to
+// bench/corpus, so it can be pointed at a production script tree.
+
+func corpusDir() string {
+	if dir := os.Getenv("RAD_BENCH_CORPUS"); dir != "" {
+		return dir
+	}
+	return "../../bench/corpus"
+}
+
+func newParser(tb testing.TB) *tree_sitter.Parser {
+	tb.Helper()
+	parser := tree_sitter.NewParser()
+	if err := parser.SetLanguage(tree_sitter.NewLanguage(tree_sitter_rad.Language())); err != nil {
+		tb.Fatalf("SetLanguage() failed: %v", err)
+	}
+	return parser
+}
+
+// sizedScript repeats bench/corpus/functions.rad, which has no preamble and
+// so stays valid when concatenated, until it is at least size bytes long.
+func sizedScript(tb testing.TB, size int) []byte {
+	tb.Helper()
+	unit, err := os.ReadFile("../../bench/corpus/functions.rad")
+	if err != nil {
+		tb.Fatalf("ReadFile() failed: %v", err)
+	}
+	return bytes.Repeat(unit, (size+len(unit)-1)/len(unit))
+}
+
+func reportNodes(b *testing.B, nodes int64) {
+	b.ReportMetric(float64(nodes)/b.Elapsed().Seconds(), "nodes/s")
+}
+
+func BenchmarkParse(b *testing.B) {
+	for _, size := range []int{1 << 10, 16 << 10, 256 << 10, 1 << 20} {
+		b.Run(fmt.Sprintf("size=%dKiB", size>>10), func(b *testing.B) {
+			src := sizedScript(b, size)
+			parser := newParser(b)
+			defer parser.Close()
+
+			tree := parser.Parse(src, nil)
+			nodes := int64(tree.RootNode().DescendantCount())
+			tree.Close()
+
+			b.SetBytes(int64(len(src)))
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				parser.Parse(src, nil).Close()
+			}
+			reportNodes(b, nodes*int64(b.N))
+		})
+	}
+}
+
+func pointAt(src []byte, offset int) tree_sitter.Point {
+	row := bytes.Count(src[:offset], []byte("\n"))
+	col := offset - (bytes.LastIndexByte(src[:offset], '\n') + 1)
+	return tree_sitter.Point{Row: uint(row), Column: uint(col)}
+}
+
+type edit struct {
+	name, anchor, insert string
+}
+
+// readEdits reads bench/corpus/edits.tsv, the reparse edits shared with the
+// other bindings' benchmarks.
+func readEdits(tb testing.TB) []edit {
+	tb.Helper()
+	data, err := os.ReadFile("../../bench/corpus/edits.tsv")
+	if err != nil {
+		tb.Fatalf("ReadFile() failed: %v", err)
+	}
+	unescape := strings.NewReplacer(`\n`, "\n", `\t`, "\t", `\\`, `\`)
+	var edits []edit
+	for _, line := range strings.Split(string(data), "\n") {
+		if line == "" || strings.HasPrefix(line, "#") {
+			continue
+		}
+		fields := strings.Split(line, "\t")
+		if len(fields) != 3 {
+			tb.Fatalf("edits.tsv: want NAME, ANCHOR and TEXT in %q", line)
+		}
+		edits = append(edits, edit{fields[0], unescape.Replace(fields[1]), unescape.Replace(fields[2])})
+	}
+	return edits
+}
+
+// BenchmarkReparse measures an edit plus incremental reparse of a 256 KiB
+// script, for each edit in bench/corpus/edits.tsv.
+func BenchmarkReparse(b *testing.B) {
+	edits := readEdits(b)
+
+	src := sizedScript(b, 256<<10)
+	parser := newParser(b)
+	defer parser.Close()
+	tree := parser.Parse(src, nil)
+	defer tree.Close()
+
+	for _, edit := range edits {
+		b.Run("edit="+edit.name, func(b *testing.B) {
+			at := bytes.Index(src[len(src)/2:], []byte(edit.anchor))
+			if at < 0 {
+				b.Fatalf("anchor %q not found past the middle of the script", edit.anchor)
+			}
+			at += len(src) / 2
+			newSrc := append(append(append([]byte{}, src[:at]...), edit.insert...), src[at:]...)
+			inputEdit := &tree_sitter.InputEdit{
+				StartByte:      uint(at),
+				OldEndByte:     uint(at),
+				NewEndByte:     uint(at + len(edit.insert)),
+				StartPosition:  pointAt(src, at),
+				OldEndPosition: pointAt(src, at),
+				NewEndPosition: pointAt(newSrc, at+len(edit.insert)),
+			}
+
+			b.SetBytes(int64(len(newSrc)))
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				old := tree.Clone()
+				old.Edit(inputEdit)
+				parser.Parse(newSrc, old).Close()
+				old.Close()
+			}
+		})
+	}
+}
+
+func readCorpus(b *testing.B) [][]byte {
+	var scripts [][]byte
+	err := filepath.WalkDir(corpusDir(), func(path string, d fs.DirEntry, err error) error {
+		if err != nil || d.IsDir() || !strings.HasSuffix(path, ".rad") {
+			return err
+		}
+		src, err := os.ReadFile(path)
+		scripts = append(scripts, src)
+		return err
+	})
+	if err != nil {
+		b.Fatalf("reading corpus failed: %v", err)
+	}
+	if len(scripts) == 0 {
+		b.Fatalf("no .rad files under %s", corpusDir())
+	}
+	return scripts
+}
+
+// BenchmarkParseDirParallel parses the corpus on GOMAXPROCS goroutines
+// sharing a parser pool; vary the parallelism with -cpu. One op is one file.
+func BenchmarkParseDirParallel(b *testing.B) {
+	scripts := readCorpus(b)
+	var total int
+	for _, src := range scripts {
+		total += len(src)
+	}
+
+	p := pool.New()
+	var next, nodes atomic.Int64
+	b.SetBytes(int64(total / len(scripts)))
+	b.ReportAllocs()
+	b.ResetTimer()
+	start := time.Now()
+	b.RunParallel(func(pb *testing.PB) {
+		for pb.Next() {
+			src := scripts[next.Add(1)%int64(len(scripts))]
+			tree, err := p.Parse(context.Background(), src)
+			if err != nil {
+				b.Error(err)
+				return
+			}
+			nodes.Add(int64(tree.RootNode().DescendantCount()))
+			tree.Close()
+		}
+	})
+	b.ReportMetric(float64(nodes.Load())/time.Since(start).Seconds(), "nodes/s")
+}
@@ -1,3 +1,5 @@
+//go:build !rad_prebuilt
+
 package tree_sitter_rad
 
 // #cgo CFLAGS: -std=c11 -fPIC
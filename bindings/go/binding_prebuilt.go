@@ -0,0 +1,33 @@
+//go:build rad_prebuilt
+
+package tree_sitter_rad
+
+// Links the archive built by `make libtree-sitter-rad.a` instead of compiling
+// src/parser.c as part of the cgo build. Rebuild the archive whenever the
+// grammar is regenerated.
+
+// #cgo CFLAGS: -std=c11 -fPIC
+// #cgo LDFLAGS: ${SRCDIR}/../../libtree-sitter-rad.a
+// #include "../c/tree-sitter-rad.h"
+import "C"
+
+import (
+	"unsafe"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+func init() {
+	// The constants are only correct for the parser.c they were generated
+	// from, which a prebuilt archive can't guarantee; a stale archive must
+	// fail here rather than misdispatch nodes later. Source builds skip the
+	// check so that `go test` can still regenerate symbols.go.
+	if err := CheckSymbols(tree_sitter.NewLanguage(Language())); err != nil {
+		panic(err)
+	}
+}
+
+// Get the tree-sitter Language for this grammar.
+func Language() unsafe.Pointer {
+	return unsafe.Pointer(C.tree_sitter_rad())
+}
@@ -0,0 +1,305 @@
+package tree_sitter_rad
+
+// #include "flatten.h"
+import "C"
+
+import (
+	"encoding/binary"
+	"errors"
+	"unsafe"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+// CSTVersion is the version of the CST file format, specified in CST.md,
+// that WriteCST writes and OpenCST reads.
+const CSTVersion = 1
+
+// CSTEmbeddedSource is the header flag set when the source follows the
+// records.
+const CSTEmbeddedSource = 1 << 0
+
+// CSTNode flags.
+const (
+	CSTNamed = 1 << iota
+	CSTExtra
+	CSTMissing
+	CSTError
+	CSTHasError
+)
+
+const (
+	cstHeaderSize = 64
+	cstNodeSize   = 44
+)
+
+// ErrInvalidCST is returned by OpenCST for data that isn't a complete CST
+// file of a version and flags this package reads, or whose records link
+// outside the records or out of pre-order or have byte ranges past the
+// source.
+var ErrInvalidCST = errors.New("tree-sitter-rad: invalid CST")
+
+// CSTHeader describes a serialized tree and the grammar and source it came
+// from.
+type CSTHeader struct {
+	Version         uint16
+	Flags           uint16
+	LanguageVersion uint32
+	SymbolCount     uint32
+	FieldCount      uint32
+	StateCount      uint32
+	GrammarHash     uint64
+	SourceHash      uint64
+	SourceLength    uint32
+	NodeCount       uint32
+}
+
+type CSTPoint struct {
+	Row    uint32
+	Column uint32
+}
+
+// CSTNode is one record of a serialized tree: a FlatNode plus its points and
+// flags. Must match TSRadCstNode in flatten.h.
+type CSTNode struct {
+	KindId      uint16
+	FieldId     uint16
+	StartByte   uint32
+	EndByte     uint32
+	Parent      uint32
+	FirstChild  uint32
+	NextSibling uint32
+	StartPoint  CSTPoint
+	EndPoint    CSTPoint
+	Flags       uint16
+	_           uint16
+}
+
+// CST is a serialized tree opened by OpenCST.
+type CST struct {
+	Header CSTHeader
+	// Nodes are in pre-order, linked as in Flatten's result.
+	Nodes []CSTNode
+	// Source is the embedded source, or nil.
+	Source []byte
+}
+
+func init() {
+	if unsafe.Sizeof(CSTNode{}) != C.sizeof_TSRadCstNode || C.sizeof_TSRadCstNode != cstNodeSize {
+		panic("tree-sitter-rad: CSTNode does not match TSRadCstNode")
+	}
+}
+
+var littleEndian = func() bool {
+	probe := uint16(1)
+	return *(*byte)(unsafe.Pointer(&probe)) == 1
+}()
+
+const (
+	fnvOffset = 14695981039346656037
+	fnvPrime  = 1099511628211
+)
+
+func fnv1a(hash uint64, data []byte) uint64 {
+	for _, b := range data {
+		hash = (hash ^ uint64(b)) * fnvPrime
+	}
+	return hash
+}
+
+func fnv1aString(hash uint64, s string) uint64 {
+	for i := 0; i < len(s); i++ {
+		hash = (hash ^ uint64(s[i])) * fnvPrime
+	}
+	// Then the NUL that ends the name in C.
+	return hash * fnvPrime
+}
+
+// SourceHash hashes a source the way CST headers do.
+func SourceHash(source []byte) uint64 {
+	return fnv1a(fnvOffset, source)
+}
+
+// GrammarHash hashes the symbol and field names of language along with its
+// table sizes, matching tree_sitter_rad_grammar_hash.
+func GrammarHash(language *tree_sitter.Language) uint64 {
+	symbolCount, fieldCount := language.NodeKindCount(), language.FieldCount()
+	var counts [16]byte
+	binary.LittleEndian.PutUint32(counts[0:], language.Version())
+	binary.LittleEndian.PutUint32(counts[4:], symbolCount)
+	binary.LittleEndian.PutUint32(counts[8:], fieldCount)
+	binary.LittleEndian.PutUint32(counts[12:], language.ParseStateCount())
+	hash := fnv1a(fnvOffset, counts[:])
+	for id := uint32(0); id < symbolCount; id++ {
+		hash = fnv1aString(hash, language.NodeKindForId(uint16(id)))
+	}
+	for id := uint32(1); id <= fieldCount; id++ {
+		hash = fnv1aString(hash, language.FieldNameForId(uint16(id)))
+	}
+	return hash
+}
+
+// WriteCST serializes tree, parsed from source, with a copy of the source if
+// embedSource is set. The nodes are gathered in a single cgo call, as by
+// Flatten.
+func WriteCST(tree *tree_sitter.Tree, source []byte, embedSource bool) []byte {
+	root := tree.RootNode()
+	capacity := int(root.DescendantCount())
+	size := cstHeaderSize + capacity*cstNodeSize
+	if embedSource {
+		size += len(source)
+	}
+	// Backed by uint64s so the records C writes are aligned.
+	words := make([]uint64, (size+7)/8)
+	data := unsafe.Slice((*byte)(unsafe.Pointer(&words[0])), size)
+
+	rootNode := *(*C.TSNode)(unsafe.Pointer(root))
+	records := (*C.TSRadCstNode)(unsafe.Pointer(&data[cstHeaderSize]))
+	count := int(C.tree_sitter_rad_flatten_cst(rootNode, records, C.uint32_t(capacity)))
+	if !littleEndian {
+		nodes := unsafe.Slice((*CSTNode)(unsafe.Pointer(records)), count)
+		for i := range nodes {
+			putNode(data[cstHeaderSize+i*cstNodeSize:], nodes[i])
+		}
+	}
+	end := cstHeaderSize + count*cstNodeSize
+	if embedSource {
+		copy(data[end:], source)
+		end += len(source)
+	}
+	data = data[:end]
+
+	language := tree.Language()
+	var flags uint16
+	if embedSource {
+		flags = CSTEmbeddedSource
+	}
+	copy(data, "RCST")
+	le := binary.LittleEndian
+	le.PutUint16(data[4:], CSTVersion)
+	le.PutUint16(data[6:], flags)
+	le.PutUint32(data[8:], language.Version())
+	le.PutUint32(data[12:], language.NodeKindCount())
+	le.PutUint32(data[16:], language.FieldCount())
+	le.PutUint32(data[20:], language.ParseStateCount())
+	le.PutUint64(data[24:], GrammarHash(language))
+	le.PutUint64(data[32:], SourceHash(source))
+	le.PutUint32(data[40:], uint32(len(source)))
+	le.PutUint32(data[44:], uint32(count))
+	le.PutUint32(data[48:], cstNodeSize)
+	return data
+}
+
+func putNode(b []byte, node CSTNode) {
+	le := binary.LittleEndian
+	le.PutUint16(b[0:], node.KindId)
+	le.PutUint16(b[2:], node.FieldId)
+	le.PutUint32(b[4:], node.StartByte)
+	le.PutUint32(b[8:], node.EndByte)
+	le.PutUint32(b[12:], node.Parent)
+	le.PutUint32(b[16:], node.FirstChild)
+	le.PutUint32(b[20:], node.NextSibling)
+	le.PutUint32(b[24:], node.StartPoint.Row)
+	le.PutUint32(b[28:], node.StartPoint.Column)
+	le.PutUint32(b[32:], node.EndPoint.Row)
+	le.PutUint32(b[36:], node.EndPoint.Column)
+	le.PutUint16(b[40:], node.Flags)
+	le.PutUint16(b[42:], 0)
+}
+
+func getNode(b []byte) CSTNode {
+	le := binary.LittleEndian
+	return CSTNode{
+		KindId:      le.Uint16(b[0:]),
+		FieldId:     le.Uint16(b[2:]),
+		StartByte:   le.Uint32(b[4:]),
+		EndByte:     le.Uint32(b[8:]),
+		Parent:      le.Uint32(b[12:]),
+		FirstChild:  le.Uint32(b[16:]),
+		NextSibling: le.Uint32(b[20:]),
+		StartPoint:  CSTPoint{le.Uint32(b[24:]), le.Uint32(b[28:])},
+		EndPoint:    CSTPoint{le.Uint32(b[32:]), le.Uint32(b[36:])},
+		Flags:       le.Uint16(b[40:]),
+	}
+}
+
+// OpenCST reads a serialized tree, checking every record so that files from
+// elsewhere can be walked safely. Nodes and Source point into data, which
+// must not be modified while they are in use, unless the records aren't
+// 4-byte aligned or the host is big-endian; then Nodes is a decoded copy.
+func OpenCST(data []byte) (*CST, error) {
+	if len(data) < cstHeaderSize || string(data[:4]) != "RCST" {
+		return nil, ErrInvalidCST
+	}
+	le := binary.LittleEndian
+	header := CSTHeader{
+		Version:         le.Uint16(data[4:]),
+		Flags:           le.Uint16(data[6:]),
+		LanguageVersion: le.Uint32(data[8:]),
+		SymbolCount:     le.Uint32(data[12:]),
+		FieldCount:      le.Uint32(data[16:]),
+		StateCount:      le.Uint32(data[20:]),
+		GrammarHash:     le.Uint64(data[24:]),
+		SourceHash:      le.Uint64(data[32:]),
+		SourceLength:    le.Uint32(data[40:]),
+		NodeCount:       le.Uint32(data[44:]),
+	}
+	if header.Version != CSTVersion || header.Flags&^CSTEmbeddedSource != 0 || le.Uint32(data[48:]) != cstNodeSize {
+		return nil, ErrInvalidCST
+	}
+	end := uint64(cstHeaderSize) + uint64(header.NodeCount)*cstNodeSize
+	sourceEnd := end
+	if header.Flags&CSTEmbeddedSource != 0 {
+		sourceEnd += uint64(header.SourceLength)
+	}
+	if uint64(len(data)) < sourceEnd {
+		return nil, ErrInvalidCST
+	}
+
+	cst := &CST{Header: header}
+	records := data[cstHeaderSize:end]
+	count := int(header.NodeCount)
+	if count > 0 && littleEndian && uintptr(unsafe.Pointer(&records[0]))%4 == 0 {
+		cst.Nodes = unsafe.Slice((*CSTNode)(unsafe.Pointer(&records[0])), count)
+	} else {
+		cst.Nodes = make([]CSTNode, count)
+		for i := range cst.Nodes {
+			cst.Nodes[i] = getNode(records[i*cstNodeSize:])
+		}
+	}
+	if !validNodes(cst.Nodes, header.SourceLength) {
+		return nil, ErrInvalidCST
+	}
+	if header.Flags&CSTEmbeddedSource != 0 {
+		cst.Source = data[end:sourceEnd:sourceEnd]
+	}
+	return cst, nil
+}
+
+// validNodes checks that every link stays inside nodes and follows
+// pre-order, so no walk goes out of bounds or around in a cycle, and that
+// every byte range is within the source.
+func validNodes(nodes []CSTNode, sourceLength uint32) bool {
+	count := uint32(len(nodes))
+	for i := uint32(0); i < count; i++ {
+		node := &nodes[i]
+		parentValid := node.Parent < i || (i == 0 && node.Parent == NoNode)
+		childValid := node.FirstChild == NoNode || (node.FirstChild == i+1 && i+1 < count)
+		siblingValid := node.NextSibling == NoNode || (node.NextSibling > i && node.NextSibling < count)
+		if !parentValid || !childValid || !siblingValid || node.StartByte > node.EndByte || node.EndByte > sourceLength {
+			return false
+		}
+	}
+	return true
+}
+
+// MatchesLanguage reports whether cst was written for language, so that its
+// kind and field ids can be used with it.
+func (cst *CST) MatchesLanguage(language *tree_sitter.Language) bool {
+	h := &cst.Header
+	return h.LanguageVersion == language.Version() &&
+		h.SymbolCount == language.NodeKindCount() &&
+		h.FieldCount == language.FieldCount() &&
+		h.StateCount == language.ParseStateCount() &&
+		h.GrammarHash == GrammarHash(language)
+}
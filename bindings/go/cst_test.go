@@ -0,0 +1,89 @@
+package tree_sitter_rad_test
+
+import (
+	"bytes"
+	"encoding/binary"
+	"os"
+	"testing"
+
+	tree_sitter_rad "github.com/amterp/tree-sitter-rad/bindings/go"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+func TestCSTRoundTrip(t *testing.T) {
+	source, err := os.ReadFile("../../complete.rsl")
+	if err != nil {
+		t.Fatalf("ReadFile() failed: %v", err)
+	}
+	tree := parseFile(t, "../../complete.rsl")
+	defer tree.Close()
+
+	data := tree_sitter_rad.WriteCST(tree, source, true)
+	cst, err := tree_sitter_rad.OpenCST(data)
+	if err != nil {
+		t.Fatalf("OpenCST() failed: %v", err)
+	}
+	if !bytes.Equal(cst.Source, source) {
+		t.Fatalf("Source differs from the written source")
+	}
+	if !cst.MatchesLanguage(tree_sitter.NewLanguage(tree_sitter_rad.Language())) {
+		t.Fatalf("MatchesLanguage() = false for the writing language")
+	}
+	if cst.Header.SourceHash != tree_sitter_rad.SourceHash(source) {
+		t.Fatalf("SourceHash = %x, want %x", cst.Header.SourceHash, tree_sitter_rad.SourceHash(source))
+	}
+
+	flat := tree_sitter_rad.Flatten(tree.RootNode(), nil)
+	if len(cst.Nodes) != len(flat) {
+		t.Fatalf("len(Nodes) = %d, want %d", len(cst.Nodes), len(flat))
+	}
+	for i, node := range cst.Nodes {
+		f := flat[i]
+		if node.KindId != f.KindId || node.FieldId != f.FieldId || node.StartByte != f.StartByte ||
+			node.EndByte != f.EndByte || node.Parent != f.Parent || node.FirstChild != f.FirstChild ||
+			node.NextSibling != f.NextSibling {
+			t.Fatalf("node %d = %+v, want %+v", i, node, f)
+		}
+	}
+	root := tree.RootNode()
+	if got := cst.Nodes[0].EndPoint; uint(got.Row) != root.EndPosition().Row || uint(got.Column) != root.EndPosition().Column {
+		t.Fatalf("root end point = %+v, want %+v", got, root.EndPosition())
+	}
+
+	// A copy at an odd address can't be used in place and is decoded.
+	shifted := make([]byte, len(data)+1)
+	copy(shifted[1:], data)
+	decoded, err := tree_sitter_rad.OpenCST(shifted[1:])
+	if err != nil {
+		t.Fatalf("OpenCST() of unaligned data failed: %v", err)
+	}
+	for i := range cst.Nodes {
+		if decoded.Nodes[i] != cst.Nodes[i] {
+			t.Fatalf("unaligned node %d = %+v, want %+v", i, decoded.Nodes[i], cst.Nodes[i])
+		}
+	}
+
+	if _, err := tree_sitter_rad.OpenCST(data[:len(data)-1]); err != tree_sitter_rad.ErrInvalidCST {
+		t.Fatalf("OpenCST() of truncated data = %v, want ErrInvalidCST", err)
+	}
+
+	// Records whose links or ranges point outside the file are rejected.
+	// Record 1 starts at 64 + 44; see CST.md for the field offsets.
+	for _, c := range []struct {
+		name   string
+		offset int
+		value  uint32
+	}{
+		{"parent", 12, 5},
+		{"first_child", 16, uint32(len(cst.Nodes))},
+		{"next_sibling", 20, 0},
+		{"end_byte", 8, uint32(len(source)) + 1},
+	} {
+		corrupt := append([]byte{}, data...)
+		binary.LittleEndian.PutUint32(corrupt[64+44+c.offset:], c.value)
+		if _, err := tree_sitter_rad.OpenCST(corrupt); err != tree_sitter_rad.ErrInvalidCST {
+			t.Errorf("OpenCST() with a bad %s = %v, want ErrInvalidCST", c.name, err)
+		}
+	}
+}
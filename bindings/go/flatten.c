@@ -0,0 +1,130 @@
+#include "flatten.h"
+
+static inline void fill(TSRadFlatNode *record, const TSTreeCursor *cursor, uint32_t parent)
+{
+    TSNode node = ts_tree_cursor_current_node(cursor);
+    record->kind_id = ts_node_symbol(node);
+    record->field_id = ts_tree_cursor_current_field_id(cursor);
+    record->start_byte = ts_node_start_byte(node);
+    record->end_byte = ts_node_end_byte(node);
+    record->parent = parent;
+    record->first_child = TS_RAD_NO_NODE;
+    record->next_sibling = TS_RAD_NO_NODE;
+}
+
+uint32_t tree_sitter_rad_flatten(TSNode root, TSRadFlatNode *nodes, uint32_t capacity)
+{
+    if (capacity == 0)
+    {
+        return 0;
+    }
+
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    fill(&nodes[0], &cursor, TS_RAD_NO_NODE);
+    // The cursor reports the field the root holds in *its* parent, which is
+    // outside the flattened range.
+    nodes[0].field_id = 0;
+
+    // Records carry their parent index, so walking back up needs no stack of
+    // its own: `current` is always the record the cursor points at.
+    uint32_t count = 1;
+    uint32_t current = 0;
+    while (count < capacity)
+    {
+        if (ts_tree_cursor_goto_first_child(&cursor))
+        {
+            fill(&nodes[count], &cursor, current);
+            nodes[current].first_child = count;
+            current = count++;
+            continue;
+        }
+
+        for (;;)
+        {
+            if (ts_tree_cursor_goto_next_sibling(&cursor))
+            {
+                fill(&nodes[count], &cursor, nodes[current].parent);
+                nodes[current].next_sibling = count;
+                current = count++;
+                break;
+            }
+            if (current == 0 || !ts_tree_cursor_goto_parent(&cursor))
+            {
+                ts_tree_cursor_delete(&cursor);
+                return count;
+            }
+            current = nodes[current].parent;
+        }
+    }
+
+    ts_tree_cursor_delete(&cursor);
+    return count;
+}
+
+static inline void fill_cst(TSRadCstNode *record, const TSTreeCursor *cursor, uint32_t parent)
+{
+    TSNode node = ts_tree_cursor_current_node(cursor);
+    uint16_t flags = 0;
+    flags |= ts_node_is_named(node) ? TS_RAD_CST_NAMED : 0;
+    flags |= ts_node_is_extra(node) ? TS_RAD_CST_EXTRA : 0;
+    flags |= ts_node_is_missing(node) ? TS_RAD_CST_MISSING : 0;
+    flags |= ts_node_is_error(node) ? TS_RAD_CST_ERROR : 0;
+    flags |= ts_node_has_error(node) ? TS_RAD_CST_HAS_ERROR : 0;
+    record->kind_id = ts_node_symbol(node);
+    record->field_id = ts_tree_cursor_current_field_id(cursor);
+    record->start_byte = ts_node_start_byte(node);
+    record->end_byte = ts_node_end_byte(node);
+    record->parent = parent;
+    record->first_child = TS_RAD_NO_NODE;
+    record->next_sibling = TS_RAD_NO_NODE;
+    record->start_point = ts_node_start_point(node);
+    record->end_point = ts_node_end_point(node);
+    record->flags = flags;
+    record->reserved = 0;
+}
+
+// The same walk as tree_sitter_rad_flatten.
+uint32_t tree_sitter_rad_flatten_cst(TSNode root, TSRadCstNode *nodes, uint32_t capacity)
+{
+    if (capacity == 0)
+    {
+        return 0;
+    }
+
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    fill_cst(&nodes[0], &cursor, TS_RAD_NO_NODE);
+    nodes[0].field_id = 0;
+
+    uint32_t count = 1;
+    uint32_t current = 0;
+    while (count < capacity)
+    {
+        if (ts_tree_cursor_goto_first_child(&cursor))
+        {
+            fill_cst(&nodes[count], &cursor, current);
+            nodes[current].first_child = count;
+            current = count++;
+            continue;
+        }
+
+        for (;;)
+        {
+            if (ts_tree_cursor_goto_next_sibling(&cursor))
+            {
+                fill_cst(&nodes[count], &cursor, nodes[current].parent);
+                nodes[current].next_sibling = count;
+                current = count++;
+                break;
+            }
+            if (current == 0 || !ts_tree_cursor_goto_parent(&cursor))
+            {
+                ts_tree_cursor_delete(&cursor);
+                return count;
+            }
+            current = nodes[current].parent;
+        }
+    }
+
+    ts_tree_cursor_delete(&cursor);
+    return count;
+}
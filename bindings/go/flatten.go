@@ -0,0 +1,71 @@
+package tree_sitter_rad
+
+// #include "flatten.h"
+import "C"
+
+import (
+	"fmt"
+	"unsafe"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+// NoNode marks a missing Parent, FirstChild or NextSibling in a FlatNode.
+const NoNode = ^uint32(0)
+
+// FlatNode is one node of a tree flattened by Flatten. Indices refer to
+// positions in the same slice.
+type FlatNode struct {
+	// KindId is the node's grammar symbol, as returned by Node.KindId.
+	KindId uint16
+	// FieldId is the field the node holds in its parent, or 0.
+	FieldId     uint16
+	StartByte   uint32
+	EndByte     uint32
+	Parent      uint32
+	FirstChild  uint32
+	NextSibling uint32
+}
+
+func init() {
+	// Flatten reinterprets go-tree-sitter's Node as the C TSNode it wraps
+	// and hands Go-allocated FlatNodes straight to C, so both layouts must
+	// agree with flatten.h.
+	if unsafe.Sizeof(tree_sitter.Node{}) != C.sizeof_TSNode {
+		panic(fmt.Sprintf("tree-sitter-rad: go-tree-sitter Node is %d bytes, expected TSNode's %d",
+			unsafe.Sizeof(tree_sitter.Node{}), C.sizeof_TSNode))
+	}
+	if unsafe.Sizeof(FlatNode{}) != C.sizeof_TSRadFlatNode {
+		panic("tree-sitter-rad: FlatNode does not match TSRadFlatNode")
+	}
+}
+
+// Flatten walks node and all of its descendants in a single cgo call and
+// returns them as pre-order records appended to dst[:0]; node itself is
+// element 0. Pass the previous result back in as dst to reuse its storage.
+//
+// Every method on tree_sitter.Node is a cgo call. Code that visits most of a
+// tree, such as an interpreter following delegate chains, should flatten it
+// once and walk the records instead.
+func Flatten(node *tree_sitter.Node, dst []FlatNode) []FlatNode {
+	count := int(node.DescendantCount())
+	if cap(dst) < count {
+		dst = make([]FlatNode, count)
+	}
+	dst = dst[:count]
+
+	root := *(*C.TSNode)(unsafe.Pointer(node))
+	written := C.tree_sitter_rad_flatten(root, (*C.TSRadFlatNode)(unsafe.Pointer(&dst[0])), C.uint32_t(count))
+	return dst[:written]
+}
+
+// ChildByFieldId returns the index of the first child of nodes[i] that holds
+// the given field, or NoNode.
+func ChildByFieldId(nodes []FlatNode, i uint32, fieldId uint16) uint32 {
+	for c := nodes[i].FirstChild; c != NoNode; c = nodes[c].NextSibling {
+		if nodes[c].FieldId == fieldId {
+			return c
+		}
+	}
+	return NoNode
+}
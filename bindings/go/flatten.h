@@ -0,0 +1,101 @@
+#ifndef TREE_SITTER_RAD_FLATTEN_H_
+#define TREE_SITTER_RAD_FLATTEN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The tree-sitter runtime is compiled by go-tree-sitter, which doesn't export
+// its headers to other modules. These declarations mirror the subset of
+// tree_sitter/api.h used here; the symbols resolve at link time. The struct
+// layouts are part of the runtime's ABI and flatten.go checks the size of
+// TSNode against go-tree-sitter's Node at init.
+
+typedef uint16_t TSSymbol;
+typedef uint16_t TSFieldId;
+typedef struct TSTree TSTree;
+
+typedef struct TSNode {
+    uint32_t context[4];
+    const void *id;
+    const TSTree *tree;
+} TSNode;
+
+typedef struct TSTreeCursor {
+    const void *tree;
+    const void *id;
+    uint32_t context[3];
+} TSTreeCursor;
+
+typedef struct TSPoint {
+    uint32_t row;
+    uint32_t column;
+} TSPoint;
+
+TSSymbol ts_node_symbol(TSNode self);
+uint32_t ts_node_start_byte(TSNode self);
+uint32_t ts_node_end_byte(TSNode self);
+TSPoint ts_node_start_point(TSNode self);
+TSPoint ts_node_end_point(TSNode self);
+bool ts_node_is_named(TSNode self);
+bool ts_node_is_extra(TSNode self);
+bool ts_node_is_missing(TSNode self);
+bool ts_node_is_error(TSNode self);
+bool ts_node_has_error(TSNode self);
+
+TSTreeCursor ts_tree_cursor_new(TSNode node);
+void ts_tree_cursor_delete(TSTreeCursor *self);
+TSNode ts_tree_cursor_current_node(const TSTreeCursor *self);
+TSFieldId ts_tree_cursor_current_field_id(const TSTreeCursor *self);
+bool ts_tree_cursor_goto_first_child(TSTreeCursor *self);
+bool ts_tree_cursor_goto_next_sibling(TSTreeCursor *self);
+bool ts_tree_cursor_goto_parent(TSTreeCursor *self);
+
+// Marks a missing parent, first child or next sibling.
+#define TS_RAD_NO_NODE UINT32_MAX
+
+// One node of a flattened tree. Must match FlatNode in flatten.go.
+typedef struct TSRadFlatNode {
+    TSSymbol kind_id;
+    TSFieldId field_id;
+    uint32_t start_byte;
+    uint32_t end_byte;
+    uint32_t parent;
+    uint32_t first_child;
+    uint32_t next_sibling;
+} TSRadFlatNode;
+
+// Writes `root` and all of its descendants, anonymous nodes and extras
+// included, to `nodes` in pre-order. Returns the number of records written,
+// which stops at `capacity`.
+uint32_t tree_sitter_rad_flatten(TSNode root, TSRadFlatNode *nodes, uint32_t capacity);
+
+enum
+{
+    TS_RAD_CST_NAMED = 1 << 0,
+    TS_RAD_CST_EXTRA = 1 << 1,
+    TS_RAD_CST_MISSING = 1 << 2,
+    TS_RAD_CST_ERROR = 1 << 3,
+    TS_RAD_CST_HAS_ERROR = 1 << 4,
+};
+
+// One record of a CST file, as TSRadCstNode in tree-sitter-rad-util.h. Must
+// match CSTNode in cst.go.
+typedef struct TSRadCstNode {
+    TSSymbol kind_id;
+    TSFieldId field_id;
+    uint32_t start_byte;
+    uint32_t end_byte;
+    uint32_t parent;
+    uint32_t first_child;
+    uint32_t next_sibling;
+    TSPoint start_point;
+    TSPoint end_point;
+    uint16_t flags;
+    uint16_t reserved;
+} TSRadCstNode;
+
+// Like tree_sitter_rad_flatten, but writes CST records, with points and
+// flags.
+uint32_t tree_sitter_rad_flatten_cst(TSNode root, TSRadCstNode *nodes, uint32_t capacity);
+
+#endif // TREE_SITTER_RAD_FLATTEN_H_
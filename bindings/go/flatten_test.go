@@ -0,0 +1,129 @@
+package tree_sitter_rad_test
+
+import (
+	"os"
+	"testing"
+
+	tree_sitter_rad "github.com/amterp/tree-sitter-rad/bindings/go"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+func parseFile(tb testing.TB, path string) *tree_sitter.Tree {
+	tb.Helper()
+	src, err := os.ReadFile(path)
+	if err != nil {
+		tb.Fatalf("ReadFile() failed: %v", err)
+	}
+	parser := tree_sitter.NewParser()
+	defer parser.Close()
+	if err := parser.SetLanguage(tree_sitter.NewLanguage(tree_sitter_rad.Language())); err != nil {
+		tb.Fatalf("SetLanguage() failed: %v", err)
+	}
+	return parser.Parse(src, nil)
+}
+
+func TestFlattenMatchesCursor(t *testing.T) {
+	tree := parseFile(t, "../../complete.rsl")
+	defer tree.Close()
+
+	nodes := tree_sitter_rad.Flatten(tree.RootNode(), nil)
+	if want := int(tree.RootNode().DescendantCount()); len(nodes) != want {
+		t.Fatalf("len(Flatten()) = %d, want %d", len(nodes), want)
+	}
+
+	cursor := tree.Walk()
+	defer cursor.Close()
+	i := uint32(0)
+	for {
+		node := cursor.Node()
+		got := nodes[i]
+		if got.KindId != node.KindId() || uint(got.StartByte) != node.StartByte() || uint(got.EndByte) != node.EndByte() {
+			t.Fatalf("node %d = %+v, want %s [%d, %d)", i, got, node.Kind(), node.StartByte(), node.EndByte())
+		}
+		if i > 0 && got.FieldId != cursor.FieldId() {
+			t.Fatalf("node %d field = %d, want %d", i, got.FieldId, cursor.FieldId())
+		}
+
+		// Step the cursor and the records in pre-order together.
+		if cursor.GotoFirstChild() {
+			i = got.FirstChild
+			continue
+		}
+		for !cursor.GotoNextSibling() {
+			if !cursor.GotoParent() {
+				return
+			}
+			i = nodes[i].Parent
+		}
+		i = nodes[i].NextSibling
+	}
+}
+
+// Each benchmark visits every node and reads its kind and byte range, which
+// is the minimum an interpreter needs to dispatch on it. The results go to
+// sink so the reads can't be optimized out.
+var sink uint
+
+func BenchmarkWalkNode(b *testing.B) {
+	tree := parseFile(b, "../../complete.rsl")
+	defer tree.Close()
+	b.ReportAllocs()
+
+	var visit func(*tree_sitter.Node) uint
+	visit = func(node *tree_sitter.Node) uint {
+		sum := uint(node.KindId()) + node.StartByte() + node.EndByte()
+		for i := uint(0); i < node.ChildCount(); i++ {
+			sum += visit(node.Child(i))
+		}
+		return sum
+	}
+	for i := 0; i < b.N; i++ {
+		sink = visit(tree.RootNode())
+	}
+	b.ReportMetric(float64(tree.RootNode().DescendantCount()), "nodes/op")
+}
+
+func BenchmarkWalkCursor(b *testing.B) {
+	tree := parseFile(b, "../../complete.rsl")
+	defer tree.Close()
+	b.ReportAllocs()
+
+	for i := 0; i < b.N; i++ {
+		cursor := tree.Walk()
+		sum := uint(0)
+	walk:
+		for {
+			node := cursor.Node()
+			sum += uint(node.KindId()) + node.StartByte() + node.EndByte()
+			if cursor.GotoFirstChild() {
+				continue
+			}
+			for !cursor.GotoNextSibling() {
+				if !cursor.GotoParent() {
+					break walk
+				}
+			}
+		}
+		cursor.Close()
+		sink = sum
+	}
+	b.ReportMetric(float64(tree.RootNode().DescendantCount()), "nodes/op")
+}
+
+func BenchmarkWalkFlat(b *testing.B) {
+	tree := parseFile(b, "../../complete.rsl")
+	defer tree.Close()
+	b.ReportAllocs()
+
+	var nodes []tree_sitter_rad.FlatNode
+	for i := 0; i < b.N; i++ {
+		nodes = tree_sitter_rad.Flatten(tree.RootNode(), nodes)
+		sum := uint(0)
+		for j := range nodes {
+			sum += uint(nodes[j].KindId) + uint(nodes[j].StartByte) + uint(nodes[j].EndByte)
+		}
+		sink = sum
+	}
+	b.ReportMetric(float64(len(nodes)), "nodes/op")
+}
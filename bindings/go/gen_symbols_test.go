@@ -0,0 +1,195 @@
+package tree_sitter_rad_test
+
+import (
+	"bytes"
+	"fmt"
+	"go/format"
+	"hash/fnv"
+	"os"
+	"regexp"
+	"strings"
+	"testing"
+
+	rts "github.com/amterp/tree-sitter-rad/bindings/go"
+	ts "github.com/tree-sitter/go-tree-sitter"
+)
+
+// Test_GenerateSymbols writes symbols.go and the C header with the same
+// constants. Identifiers are taken from the enums in parser.c, which are
+// unique even where several symbols share a kind name; names and counts come
+// from the loaded language.
+func Test_GenerateSymbols(t *testing.T) {
+	lang := ts.NewLanguage(rts.Language())
+
+	parserC, err := os.ReadFile("../../src/parser.c")
+	if err != nil {
+		t.Fatalf("ReadFile() failed: %v", err)
+	}
+	symbolIdents := parseEnum(t, parserC, "ts_symbol_identifiers")
+	symbolIdents[0] = "sym_end"
+	fieldIdents := parseEnum(t, parserC, "ts_field_identifiers")
+	version := parseDefine(t, parserC, "LANGUAGE_VERSION")
+	stateCount := parseDefine(t, parserC, "STATE_COUNT")
+
+	symbolCount := int(lang.NodeKindCount())
+	fieldCount := int(lang.FieldCount())
+	if len(symbolIdents) != symbolCount || len(fieldIdents) != fieldCount {
+		t.Fatalf("parser.c enums (%d symbols, %d fields) don't match the language (%d, %d)",
+			len(symbolIdents), len(fieldIdents), symbolCount, fieldCount)
+	}
+
+	hash := fnv.New64a()
+	for i := 0; i < symbolCount; i++ {
+		hash.Write([]byte(lang.NodeKindForId(uint16(i))))
+		hash.Write([]byte{0})
+	}
+	for i := 1; i <= fieldCount; i++ {
+		hash.Write([]byte(lang.FieldNameForId(uint16(i))))
+		hash.Write([]byte{0})
+	}
+
+	var g bytes.Buffer
+	fmt.Fprintf(&g, "// Code generated by gen_symbols_test.go; DO NOT EDIT.\n\n")
+	fmt.Fprintf(&g, "package tree_sitter_rad\n\n")
+	fmt.Fprintf(&g, "const (\n")
+	fmt.Fprintf(&g, "LanguageVersion = %s\n", version)
+	fmt.Fprintf(&g, "StateCount = %s\n", stateCount)
+	fmt.Fprintf(&g, "SymbolCount = %d\n", symbolCount)
+	fmt.Fprintf(&g, "FieldCount = %d\n", fieldCount)
+	fmt.Fprintf(&g, "\n// SymbolHash is an FNV-1a hash of every symbol and field name in id order.\n")
+	fmt.Fprintf(&g, "SymbolHash = 0x%016x\n", hash.Sum64())
+	fmt.Fprintf(&g, ")\n\n")
+	fmt.Fprintf(&g, "const (\n")
+	for i := 0; i < symbolCount; i++ {
+		fmt.Fprintf(&g, "%s Symbol = %d // %s\n", goSymbolName(symbolIdents[i]), i, lang.NodeKindForId(uint16(i)))
+	}
+	fmt.Fprintf(&g, "SymError Symbol = 65535 // ERROR\n")
+	fmt.Fprintf(&g, ")\n\n")
+	fmt.Fprintf(&g, "const (\n")
+	for i := 1; i <= fieldCount; i++ {
+		fmt.Fprintf(&g, "Field%s Field = %d\n", camel(strings.TrimPrefix(fieldIdents[i], "field_")), i)
+	}
+	fmt.Fprintf(&g, ")\n")
+
+	src, err := format.Source(g.Bytes())
+	if err != nil {
+		t.Fatalf("format.Source() failed: %v", err)
+	}
+	writeFile(t, "symbols.go", src)
+
+	var c bytes.Buffer
+	fmt.Fprintf(&c, "// Code generated by bindings/go/gen_symbols_test.go; DO NOT EDIT.\n\n")
+	fmt.Fprintf(&c, "#ifndef TREE_SITTER_RAD_SYMBOLS_H_\n#define TREE_SITTER_RAD_SYMBOLS_H_\n\n")
+	fmt.Fprintf(&c, "#define TS_RAD_LANGUAGE_VERSION %s\n", version)
+	fmt.Fprintf(&c, "#define TS_RAD_STATE_COUNT %s\n", stateCount)
+	fmt.Fprintf(&c, "#define TS_RAD_SYMBOL_COUNT %d\n", symbolCount)
+	fmt.Fprintf(&c, "#define TS_RAD_FIELD_COUNT %d\n", fieldCount)
+	fmt.Fprintf(&c, "#define TS_RAD_SYMBOL_HASH 0x%016xULL\n\n", hash.Sum64())
+	fmt.Fprintf(&c, "enum ts_rad_symbol {\n")
+	for i := 0; i < symbolCount; i++ {
+		fmt.Fprintf(&c, "    TS_RAD_%s = %d,\n", strings.ToUpper(symbolIdents[i]), i)
+	}
+	fmt.Fprintf(&c, "    TS_RAD_SYM_ERROR = 65535,\n};\n\n")
+	fmt.Fprintf(&c, "enum ts_rad_field {\n")
+	for i := 1; i <= fieldCount; i++ {
+		fmt.Fprintf(&c, "    TS_RAD_%s = %d,\n", strings.ToUpper(fieldIdents[i]), i)
+	}
+	fmt.Fprintf(&c, "};\n\n")
+	c.WriteString(symbolsCheck)
+	fmt.Fprintf(&c, "\n#endif // TREE_SITTER_RAD_SYMBOLS_H_\n")
+	writeFile(t, "../c/tree-sitter-rad-symbols.h", c.Bytes())
+}
+
+// The check only compiles where tree_sitter/api.h was included first, since
+// it needs the runtime's name lookups.
+const symbolsCheck = `#ifdef TREE_SITTER_API_H_
+static inline uint64_t ts_rad_fnv1a(uint64_t hash, const char *name) {
+    for (const char *c = name ? name : ""; ; c++) {
+        hash = (hash ^ (uint8_t)*c) * 0x100000001b3ULL;
+        if (!*c) return hash;
+    }
+}
+
+// Returns whether the linked parser was generated from the same grammar as
+// this header, by comparing every symbol and field name.
+static inline bool tree_sitter_rad_symbols_match(const TSLanguage *language) {
+    if (ts_language_symbol_count(language) != TS_RAD_SYMBOL_COUNT ||
+        ts_language_field_count(language) != TS_RAD_FIELD_COUNT) {
+        return false;
+    }
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (uint32_t id = 0; id < TS_RAD_SYMBOL_COUNT; id++) {
+        hash = ts_rad_fnv1a(hash, ts_language_symbol_name(language, (TSSymbol)id));
+    }
+    for (uint32_t id = 1; id <= TS_RAD_FIELD_COUNT; id++) {
+        hash = ts_rad_fnv1a(hash, ts_language_field_name_for_id(language, (TSFieldId)id));
+    }
+    return hash == TS_RAD_SYMBOL_HASH;
+}
+#endif
+`
+
+func parseEnum(t *testing.T, src []byte, name string) map[int]string {
+	start := bytes.Index(src, []byte("enum "+name+" {"))
+	if start < 0 {
+		t.Fatalf("enum %s not found in parser.c", name)
+	}
+	body := src[start:]
+	body = body[:bytes.Index(body, []byte("};"))]
+
+	idents := map[int]string{}
+	for _, m := range regexp.MustCompile(`(?m)^\s+(\w+) = (\d+),$`).FindAllSubmatch(body, -1) {
+		var id int
+		fmt.Sscan(string(m[2]), &id)
+		idents[id] = string(m[1])
+	}
+	return idents
+}
+
+func parseDefine(t *testing.T, src []byte, name string) string {
+	m := regexp.MustCompile(`(?m)^#define ` + name + ` (\d+)$`).FindSubmatch(src)
+	if m == nil {
+		t.Fatalf("#define %s not found in parser.c", name)
+	}
+	return string(m[1])
+}
+
+// goSymbolName maps a parser.c identifier to an exported Go name, keeping the
+// symbol's category so that e.g. the `list` keyword and the list node differ.
+func goSymbolName(ident string) string {
+	for _, p := range []struct{ prefix, name string }{
+		{"anon_sym_", "SymAnon"},
+		{"aux_sym_", "SymAux"},
+		{"alias_sym_", "SymAlias"},
+		{"sym__", "SymHidden"},
+		{"sym_", "Sym"},
+	} {
+		if strings.HasPrefix(ident, p.prefix) {
+			return p.name + camel(strings.TrimPrefix(ident, p.prefix))
+		}
+	}
+	panic("unexpected symbol identifier " + ident)
+}
+
+// camel converts snake_case to CamelCase. Anonymous tokens are spelled in
+// upper case by tree-sitter (QMARK_QMARK), which becomes QmarkQmark.
+func camel(s string) string {
+	var b strings.Builder
+	for _, part := range strings.Split(s, "_") {
+		if part == "" {
+			continue
+		}
+		if strings.ToUpper(part) == part {
+			part = strings.ToLower(part)
+		}
+		b.WriteString(strings.ToUpper(part[:1]) + part[1:])
+	}
+	return b.String()
+}
+
+func writeFile(t *testing.T, path string, content []byte) {
+	fmt.Printf("Writing to %s\n", path)
+	if err := os.WriteFile(path, content, 0o644); err != nil {
+		t.Fatalf("WriteFile() failed: %v", err)
+	}
+}
@@ -0,0 +1,53 @@
+package pool
+
+import (
+	"bytes"
+	"context"
+	"errors"
+	"os"
+	"sync/atomic"
+	"testing"
+)
+
+func TestParseCancelled(t *testing.T) {
+	src, err := os.ReadFile("../../../complete.rsl")
+	if err != nil {
+		t.Fatalf("ReadFile() failed: %v", err)
+	}
+	// Far more than the parser gets through between two cancellation checks,
+	// so only the flag can make it return without a tree.
+	large := bytes.Repeat(src, (1<<20)/len(src)+1)
+
+	// Use one entry directly so the follow-up parse is sure to get the
+	// parser that was cancelled.
+	e := New().parsers.Get().(*entry)
+
+	ctx, cancel := context.WithCancel(context.Background())
+	cancel()
+	tree, err := e.parse(ctx, large, nil)
+	if tree != nil {
+		tree.Close()
+		t.Fatalf("parse() returned a tree, error = %v; the cancellation flag was not set", err)
+	}
+	if !errors.Is(err, context.Canceled) {
+		t.Fatalf("parse() error = %v, want context.Canceled", err)
+	}
+	if flag := atomic.LoadUintptr(e.flag); flag != 0 {
+		t.Fatalf("cancellation flag = %d after parse(), want 0", flag)
+	}
+
+	// The cancelled parser must have dropped its state, so it parses the next
+	// script in full.
+	tree, err = e.parse(context.Background(), src, nil)
+	if err != nil {
+		t.Fatalf("parse() after cancellation failed: %v", err)
+	}
+	defer tree.Close()
+	root := tree.RootNode()
+	if root.HasError() {
+		t.Errorf("parse() after cancellation has errors: %s", root.ToSexp())
+	}
+	if end := root.EndByte(); end != uint(len(src)) {
+		t.Errorf("parse() after cancellation ends at byte %d, want %d", end, len(src))
+	}
+}
@@ -0,0 +1,142 @@
+// Package pool provides a concurrency-safe parser service for the Rad grammar.
+//
+// Creating a tree-sitter parser allocates the parser itself, its parse stack
+// and the external scanner's indent and delimiter stacks. Callers that parse
+// many scripts (the Rad interpreter, language servers, analysis tools) should
+// share a Pool rather than creating and closing a parser per script.
+package pool
+
+// #include <stdlib.h>
+import "C"
+
+import (
+	"context"
+	"errors"
+	"runtime"
+	"sync"
+	"sync/atomic"
+	"unsafe"
+
+	tree_sitter_rad "github.com/amterp/tree-sitter-rad/bindings/go"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+// ErrParseFailed is returned when the parser produced no tree for a reason
+// other than cancellation of the caller's context.
+var ErrParseFailed = errors.New("tree-sitter-rad: parse failed")
+
+// entry is a pooled parser together with its cancellation flag.
+//
+// The flag is allocated on the C heap because the parser keeps the pointer
+// and polls it while parsing, which cgo does not allow for Go memory.
+type entry struct {
+	parser *tree_sitter.Parser
+	flag   *uintptr
+}
+
+func newEntry(language *tree_sitter.Language) *entry {
+	parser := tree_sitter.NewParser()
+	if err := parser.SetLanguage(language); err != nil {
+		parser.Close()
+		panic(err)
+	}
+
+	e := &entry{
+		parser: parser,
+		flag:   (*uintptr)(C.calloc(1, C.size_t(unsafe.Sizeof(uintptr(0))))),
+	}
+	parser.SetCancellationFlag(e.flag)
+
+	// sync.Pool drops idle entries during GC without telling us, so the C
+	// side of the parser has to be released from a finalizer.
+	runtime.SetFinalizer(e, (*entry).close)
+	return e
+}
+
+func (e *entry) close() {
+	e.parser.SetCancellationFlag(nil)
+	e.parser.Close()
+	C.free(unsafe.Pointer(e.flag))
+}
+
+// Pool hands out Rad parsers to concurrent callers. The zero value is not
+// usable; create one with New. A Pool must not be copied after first use.
+type Pool struct {
+	language *tree_sitter.Language
+	parsers  sync.Pool
+}
+
+// New returns an empty pool. Parsers are created on demand and reused across
+// calls, so a pool warms up to the level of concurrency it is used at.
+func New() *Pool {
+	p := &Pool{language: tree_sitter.NewLanguage(tree_sitter_rad.Language())}
+	p.parsers.New = func() any { return newEntry(p.language) }
+	return p
+}
+
+// Parse parses src with a pooled parser.
+//
+// If ctx is cancelled while parsing, the parser stops at its next
+// cancellation check and Parse returns ctx.Err(). The returned tree belongs to
+// the caller and must be closed.
+func (p *Pool) Parse(ctx context.Context, src []byte) (*tree_sitter.Tree, error) {
+	return p.Reparse(ctx, src, nil)
+}
+
+// Reparse is Parse with a previous tree of the same document, which must
+// already have been edited to match src, so unchanged subtrees are reused.
+func (p *Pool) Reparse(ctx context.Context, src []byte, oldTree *tree_sitter.Tree) (*tree_sitter.Tree, error) {
+	if err := ctx.Err(); err != nil {
+		return nil, err
+	}
+
+	e := p.parsers.Get().(*entry)
+	defer p.parsers.Put(e)
+	return e.parse(ctx, src, oldTree)
+}
+
+// parse runs one parse that stops when ctx is cancelled, and leaves the
+// parser ready for an unrelated document.
+func (e *entry) parse(ctx context.Context, src []byte, oldTree *tree_sitter.Tree) (*tree_sitter.Tree, error) {
+	// Background and TODO contexts can never be cancelled; skip the watcher
+	// so the common case doesn't allocate.
+	if ctx.Done() == nil {
+		return treeOrErr(ctx, e.parser.Parse(src, oldTree))
+	}
+
+	fired := make(chan struct{})
+	stop := context.AfterFunc(ctx, func() {
+		atomic.StoreUintptr(e.flag, 1)
+		close(fired)
+	})
+	if ctx.Err() != nil {
+		// Already cancelled: the watcher is about to run, so wait for it and
+		// let the parse stop at its first check.
+		<-fired
+	}
+
+	tree := e.parser.Parse(src, oldTree)
+
+	if !stop() {
+		// The watcher has started. Wait for its store before clearing the
+		// flag, or the next caller's parse would be cancelled instead.
+		<-fired
+		atomic.StoreUintptr(e.flag, 0)
+		// A cancelled parser keeps its state so the same document can be
+		// resumed. Pooled parsers serve unrelated documents, so drop it.
+		e.parser.Reset()
+	}
+
+	return treeOrErr(ctx, tree)
+}
+
+func treeOrErr(ctx context.Context, tree *tree_sitter.Tree) (*tree_sitter.Tree, error) {
+	if tree != nil {
+		return tree, nil
+	}
+	if err := ctx.Err(); err != nil {
+		return nil, err
+	}
+	return nil, ErrParseFailed
+}
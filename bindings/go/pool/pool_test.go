@@ -0,0 +1,132 @@
+package pool_test
+
+import (
+	"context"
+	"os"
+	"sync"
+	"testing"
+
+	tree_sitter_rad "github.com/amterp/tree-sitter-rad/bindings/go"
+	"github.com/amterp/tree-sitter-rad/bindings/go/pool"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+func readScript(tb testing.TB) []byte {
+	tb.Helper()
+	src, err := os.ReadFile("../../../complete.rsl")
+	if err != nil {
+		tb.Fatalf("ReadFile() failed: %v", err)
+	}
+	return src
+}
+
+func TestParse(t *testing.T) {
+	p := pool.New()
+	src := readScript(t)
+
+	var wg sync.WaitGroup
+	for i := 0; i < 8; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			tree, err := p.Parse(context.Background(), src)
+			if err != nil {
+				t.Errorf("Parse() failed: %v", err)
+				return
+			}
+			defer tree.Close()
+			if kind := tree.RootNode().Kind(); kind != "source_file" {
+				t.Errorf("root kind = %q, want source_file", kind)
+			}
+		}()
+	}
+	wg.Wait()
+}
+
+// BenchmarkParseNewParser is the baseline: what every consumer did before the
+// pool existed.
+func BenchmarkParseNewParser(b *testing.B) {
+	language := tree_sitter.NewLanguage(tree_sitter_rad.Language())
+	src := readScript(b)
+	b.SetBytes(int64(len(src)))
+	b.ReportAllocs()
+
+	for i := 0; i < b.N; i++ {
+		parser := tree_sitter.NewParser()
+		if err := parser.SetLanguage(language); err != nil {
+			b.Fatal(err)
+		}
+		parser.Parse(src, nil).Close()
+		parser.Close()
+	}
+}
+
+func BenchmarkParsePool(b *testing.B) {
+	p := pool.New()
+	src := readScript(b)
+	b.SetBytes(int64(len(src)))
+	b.ReportAllocs()
+
+	for i := 0; i < b.N; i++ {
+		tree, err := p.Parse(context.Background(), src)
+		if err != nil {
+			b.Fatal(err)
+		}
+		tree.Close()
+	}
+}
+
+func BenchmarkParsePoolCancellable(b *testing.B) {
+	p := pool.New()
+	src := readScript(b)
+	ctx, cancel := context.WithCancel(context.Background())
+	defer cancel()
+	b.SetBytes(int64(len(src)))
+	b.ReportAllocs()
+
+	for i := 0; i < b.N; i++ {
+		tree, err := p.Parse(ctx, src)
+		if err != nil {
+			b.Fatal(err)
+		}
+		tree.Close()
+	}
+}
+
+func BenchmarkParseNewParserParallel(b *testing.B) {
+	language := tree_sitter.NewLanguage(tree_sitter_rad.Language())
+	src := readScript(b)
+	b.SetBytes(int64(len(src)))
+	b.ReportAllocs()
+
+	b.RunParallel(func(pb *testing.PB) {
+		for pb.Next() {
+			parser := tree_sitter.NewParser()
+			if err := parser.SetLanguage(language); err != nil {
+				b.Error(err)
+				return
+			}
+			parser.Parse(src, nil).Close()
+			parser.Close()
+		}
+	})
+}
+
+func BenchmarkParsePoolParallel(b *testing.B) {
+	p := pool.New()
+	src := readScript(b)
+	b.SetBytes(int64(len(src)))
+	b.ReportAllocs()
+
+	b.RunParallel(func(pb *testing.PB) {
+		for pb.Next() {
+			tree, err := p.Parse(context.Background(), src)
+			if err != nil {
+				b.Error(err)
+				return
+			}
+			tree.Close()
+		}
+	})
+}
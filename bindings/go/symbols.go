@@ -0,0 +1,455 @@
+// Code generated by gen_symbols_test.go; DO NOT EDIT.
+
+package tree_sitter_rad
+
+const (
+	LanguageVersion = 14
+	StateCount      = 4214
+	SymbolCount     = 329
+	FieldCount      = 106
+
+	// SymbolHash is an FNV-1a hash of every symbol and field name in id order.
+	SymbolHash = 0x3e56705523c0c575
+)
+
+const (
+	SymEnd                             Symbol = 0     // end
+	SymIdentifierRegex                 Symbol = 1     // identifier
+	SymShebang                         Symbol = 2     // shebang
+	SymAuxFileHeaderContentsToken1     Symbol = 3     // file_header_contents_token1
+	SymAuxFileHeaderContentsToken2     Symbol = 4     // file_header_contents_token2
+	SymAnonDashDashDash                Symbol = 5     // ---
+	SymAnonQmark                       Symbol = 6     // ?
+	SymAnonColon                       Symbol = 7     // :
+	SymAnonOr                          Symbol = 8     // or
+	SymAnonAnd                         Symbol = 9     // and
+	SymAnonLt                          Symbol = 10    // <
+	SymAnonLtEq                        Symbol = 11    // <=
+	SymAnonEqEq                        Symbol = 12    // ==
+	SymAnonBangEq                      Symbol = 13    // !=
+	SymAnonGtEq                        Symbol = 14    // >=
+	SymAnonGt                          Symbol = 15    // >
+	SymAnonIn                          Symbol = 16    // in
+	SymAnonNot                         Symbol = 17    // not
+	SymAnonStar                        Symbol = 18    // *
+	SymAnonSlash                       Symbol = 19    // /
+	SymAnonPercent                     Symbol = 20    // %
+	SymAnonQmarkQmark                  Symbol = 21    // ??
+	SymAnonCatch                       Symbol = 22    // catch
+	SymAnonLparen                      Symbol = 23    // (
+	SymAnonRparen                      Symbol = 24    // )
+	SymAnonComma                       Symbol = 25    // ,
+	SymAnonEq                          Symbol = 26    // =
+	SymAnonPlus                        Symbol = 27    // +
+	SymAnonDash                        Symbol = 28    // -
+	SymAnonPlusEq                      Symbol = 29    // +=
+	SymAnonDashEq                      Symbol = 30    // -=
+	SymAnonStarEq                      Symbol = 31    // *=
+	SymAnonSlashEq                     Symbol = 32    // /=
+	SymAnonPercentEq                   Symbol = 33    // %=
+	SymAnonPlusPlus                    Symbol = 34    // ++
+	SymAnonDashDash                    Symbol = 35    // --
+	SymAnonLbrack                      Symbol = 36    // [
+	SymAnonRbrack                      Symbol = 37    // ]
+	SymAnonDot                         Symbol = 38    // .
+	SymAnonJson                        Symbol = 39    // json
+	SymAnonDel                         Symbol = 40    // del
+	SymBreakStmt                       Symbol = 41    // break_stmt
+	SymContinueStmt                    Symbol = 42    // continue_stmt
+	SymPassStmt                        Symbol = 43    // pass_stmt
+	SymAnonElse                        Symbol = 44    // else
+	SymAnonIf                          Symbol = 45    // if
+	SymAnonWhile                       Symbol = 46    // while
+	SymAnonFor                         Symbol = 47    // for
+	SymAnonWith                        Symbol = 48    // with
+	SymAnonSwitch                      Symbol = 49    // switch
+	SymAnonCase                        Symbol = 50    // case
+	SymAnonDashGt                      Symbol = 51    // ->
+	SymAnonYield                       Symbol = 52    // yield
+	SymAnonDefault                     Symbol = 53    // default
+	SymAnonQuiet                       Symbol = 54    // quiet
+	SymAnonConfirm                     Symbol = 55    // confirm
+	SymAnonDollar                      Symbol = 56    // $
+	SymAnonArgs                        Symbol = 57    // args
+	SymAuxArgCommentToken1             Symbol = 58    // _arg_comment_token1
+	SymCommentText                     Symbol = 59    // comment_text
+	SymShorthandFlag                   Symbol = 60    // shorthand_flag
+	SymAnonEnum                        Symbol = 61    // enum
+	SymAnonRegex                       Symbol = 62    // regex
+	SymAnonRange                       Symbol = 63    // range
+	SymAnonLen                         Symbol = 64    // len
+	SymAnonMutually                    Symbol = 65    // mutually
+	SymAnonRequires                    Symbol = 66    // requires
+	SymAnonExcludes                    Symbol = 67    // excludes
+	SymAnonCommand                     Symbol = 68    // command
+	SymAnonCalls                       Symbol = 69    // calls
+	SymAnonRad                         Symbol = 70    // rad
+	SymAnonRequest                     Symbol = 71    // request
+	SymAnonDisplay                     Symbol = 72    // display
+	SymAnonInsecure                    Symbol = 73    // insecure
+	SymAnonNoprint                     Symbol = 74    // noprint
+	SymAnonTranspose                   Symbol = 75    // transpose
+	SymAnonSort                        Symbol = 76    // sort
+	SymAuxRadSortSpecifierToken1       Symbol = 77    // rad_sort_specifier_token1
+	SymAnonAsc                         Symbol = 78    // asc
+	SymAnonDesc                        Symbol = 79    // desc
+	SymImmediateIdentifier             Symbol = 80    // immediate_identifier
+	SymAnonFields                      Symbol = 81    // fields
+	SymAnonColor                       Symbol = 82    // color
+	SymAnonMap                         Symbol = 83    // map
+	SymAnonFilter                      Symbol = 84    // filter
+	SymAnonDefer                       Symbol = 85    // defer
+	SymAnonErrdefer                    Symbol = 86    // errdefer
+	SymAnonFn                          Symbol = 87    // fn
+	SymAnonPipe                        Symbol = 88    // |
+	SymAnonLbrackRbrack                Symbol = 89    // []
+	SymAnonReturn                      Symbol = 90    // return
+	SymComment                         Symbol = 91    // comment
+	SymStringType                      Symbol = 92    // string_type
+	SymIntType                         Symbol = 93    // int_type
+	SymFloatType                       Symbol = 94    // float_type
+	SymBoolType                        Symbol = 95    // bool_type
+	SymStringListType                  Symbol = 96    // string_list_type
+	SymIntListType                     Symbol = 97    // int_list_type
+	SymFloatListType                   Symbol = 98    // float_list_type
+	SymBoolListType                    Symbol = 99    // bool_list_type
+	SymAnonList                        Symbol = 100   // list
+	SymErrorType                       Symbol = 101   // error_type
+	SymVoidType                        Symbol = 102   // void_type
+	SymAnyType                         Symbol = 103   // any_type
+	SymAnonLbrace                      Symbol = 104   // {
+	SymAnonRbrace                      Symbol = 105   // }
+	SymEscSingleQuote                  Symbol = 106   // esc_single_quote
+	SymEscDoubleQuote                  Symbol = 107   // esc_double_quote
+	SymEscBacktick                     Symbol = 108   // esc_backtick
+	SymEscNewline                      Symbol = 109   // esc_newline
+	SymEscTab                          Symbol = 110   // esc_tab
+	SymEscBackslash                    Symbol = 111   // esc_backslash
+	SymEscOpenBracket                  Symbol = 112   // esc_open_bracket
+	SymEscCloseBracket                 Symbol = 113   // esc_close_bracket
+	SymAnonBslash                      Symbol = 114   // \
+	SymFillAlignment                   Symbol = 115   // fill_alignment
+	SymAnonUnsafe                      Symbol = 116   // identifier
+	SymInt                             Symbol = 117   // int
+	SymFloat                           Symbol = 118   // float
+	SymScientificNumber                Symbol = 119   // scientific_number
+	SymAnonTrue                        Symbol = 120   // true
+	SymAnonFalse                       Symbol = 121   // false
+	SymNull                            Symbol = 122   // null
+	SymHiddenNewline                   Symbol = 123   // _newline
+	SymHiddenIndent                    Symbol = 124   // _indent
+	SymHiddenDedent                    Symbol = 125   // _dedent
+	SymStringStart                     Symbol = 126   // string_start
+	SymStringContent                   Symbol = 127   // string_content
+	SymStringEnd                       Symbol = 128   // string_end
+	SymHiddenBlockColon                Symbol = 129   // _block_colon
+	SymSourceFile                      Symbol = 130   // source_file
+	SymFileHeader                      Symbol = 131   // file_header
+	SymFileHeaderContents              Symbol = 132   // file_header_contents
+	SymHiddenFileHeaderLine            Symbol = 133   // _file_header_line
+	SymHiddenStmt                      Symbol = 134   // _stmt
+	SymHiddenSimpleStmts               Symbol = 135   // _simple_stmts
+	SymHiddenSimpleStmt                Symbol = 136   // _simple_stmt
+	SymExprStmt                        Symbol = 137   // expr_stmt
+	SymHiddenLambdaCompatStmt          Symbol = 138   // _lambda_compat_stmt
+	SymExpr                            Symbol = 139   // expr
+	SymTernaryExpr                     Symbol = 140   // ternary_expr
+	SymOrExpr                          Symbol = 141   // or_expr
+	SymAndExpr                         Symbol = 142   // and_expr
+	SymCompareExpr                     Symbol = 143   // compare_expr
+	SymNotIn                           Symbol = 144   // not_in
+	SymAddExpr                         Symbol = 145   // add_expr
+	SymMultExpr                        Symbol = 146   // mult_expr
+	SymUnaryExpr                       Symbol = 147   // unary_expr
+	SymFallbackExpr                    Symbol = 148   // fallback_expr
+	SymCatchExpr                       Symbol = 149   // catch_expr
+	SymHiddenSignedOperand             Symbol = 150   // _signed_operand
+	SymHiddenSignedPostfix             Symbol = 151   // unary_expr
+	SymHiddenPostfixExpr               Symbol = 152   // _postfix_expr
+	SymIndexedExpr                     Symbol = 153   // indexed_expr
+	SymPrimaryExpr                     Symbol = 154   // primary_expr
+	SymParenthesizedExpr               Symbol = 155   // parenthesized_expr
+	SymCall                            Symbol = 156   // call
+	SymHiddenCallArgList               Symbol = 157   // _call_arg_list
+	SymCallNamedArg                    Symbol = 158   // call_named_arg
+	SymHiddenUnaryOpSign               Symbol = 159   // _unary_op_sign
+	SymAssign                          Symbol = 160   // assign
+	SymTypedAssign                     Symbol = 161   // typed_assign
+	SymCatchBlock                      Symbol = 162   // catch_block
+	SymCompoundAssign                  Symbol = 163   // compound_assign
+	SymIncrDecr                        Symbol = 164   // incr_decr
+	SymHiddenLeftSideSingle            Symbol = 165   // _left_side_single
+	SymHiddenLeftSide                  Symbol = 166   // _left_side
+	SymHiddenRightSideSingle           Symbol = 167   // _right_side_single
+	SymHiddenRightSide                 Symbol = 168   // _right_side
+	SymVarPath                         Symbol = 169   // var_path
+	SymIncrDecrLeft                    Symbol = 170   // var_path
+	SymHiddenIndexing                  Symbol = 171   // _indexing
+	SymSlice                           Symbol = 172   // slice
+	SymJsonPath                        Symbol = 173   // json_path
+	SymJsonOpener                      Symbol = 174   // json_opener
+	SymJsonSegment                     Symbol = 175   // json_segment
+	SymJsonPathIndexer                 Symbol = 176   // json_path_indexer
+	SymDelStmt                         Symbol = 177   // del_stmt
+	SymHiddenComplexStmt               Symbol = 178   // _complex_stmt
+	SymIfStmt                          Symbol = 179   // if_stmt
+	SymIfAlt                           Symbol = 180   // if_alt
+	SymHiddenIfClause                  Symbol = 181   // _if_clause
+	SymElseAlt                         Symbol = 182   // else_alt
+	SymForLoop                         Symbol = 183   // for_loop
+	SymWhileLoop                       Symbol = 184   // while_loop
+	SymHiddenForIn                     Symbol = 185   // _for_in
+	SymForLefts                        Symbol = 186   // for_lefts
+	SymListComprehension               Symbol = 187   // list_comprehension
+	SymSwitchStmt                      Symbol = 188   // switch_stmt
+	SymSwitchCase                      Symbol = 189   // switch_case
+	SymHiddenSwitchCaseValueAlt        Symbol = 190   // _switch_case_value_alt
+	SymSwitchCaseExpr                  Symbol = 191   // switch_case_expr
+	SymSwitchCaseBlock                 Symbol = 192   // switch_case_block
+	SymYieldStmt                       Symbol = 193   // yield_stmt
+	SymSwitchDefault                   Symbol = 194   // switch_default
+	SymHiddenShellOperand              Symbol = 195   // _shell_operand
+	SymShellCmd                        Symbol = 196   // shell_cmd
+	SymArgBlock                        Symbol = 197   // arg_block
+	SymHiddenArgStmt                   Symbol = 198   // _arg_stmt
+	SymArgDeclaration                  Symbol = 199   // arg_declaration
+	SymHiddenVariadicArgDeclaration    Symbol = 200   // _variadic_arg_declaration
+	SymHiddenNonVariadicArgDeclaration Symbol = 201   // _non_variadic_arg_declaration
+	SymHiddenArgComment                Symbol = 202   // _arg_comment
+	SymHiddenTypeAndorDefault          Symbol = 203   // _type_andor_default
+	SymHiddenVariadicTypeAndorDefault  Symbol = 204   // _variadic_type_andor_default
+	SymHiddenArgStringDefault          Symbol = 205   // _arg_string_default
+	SymHiddenArgIntDefault             Symbol = 206   // _arg_int_default
+	SymHiddenArgFloatDefault           Symbol = 207   // _arg_float_default
+	SymHiddenArgBoolDefault            Symbol = 208   // _arg_bool_default
+	SymHiddenArgStringListDefault      Symbol = 209   // _arg_string_list_default
+	SymHiddenArgIntListDefault         Symbol = 210   // _arg_int_list_default
+	SymHiddenArgFloatListDefault       Symbol = 211   // _arg_float_list_default
+	SymHiddenArgBoolListDefault        Symbol = 212   // _arg_bool_list_default
+	SymHiddenArgStringVarDefault       Symbol = 213   // _arg_string_var_default
+	SymHiddenArgIntVarDefault          Symbol = 214   // _arg_int_var_default
+	SymHiddenArgFloatVarDefault        Symbol = 215   // _arg_float_var_default
+	SymHiddenArgBoolVarDefault         Symbol = 216   // _arg_bool_var_default
+	SymIntArg                          Symbol = 217   // int_arg
+	SymFloatArg                        Symbol = 218   // float_arg
+	SymHiddenArgConstraint             Symbol = 219   // _arg_constraint
+	SymArgEnumConstraint               Symbol = 220   // arg_enum_constraint
+	SymArgRegexConstraint              Symbol = 221   // arg_regex_constraint
+	SymArgRangeConstraint              Symbol = 222   // arg_range_constraint
+	SymHiddenArgRangeConstraintMinOnly Symbol = 223   // _arg_range_constraint_min_only
+	SymHiddenArgRangeConstraintMaxOnly Symbol = 224   // _arg_range_constraint_max_only
+	SymHiddenArgRangeConstraintMinMax  Symbol = 225   // _arg_range_constraint_min_max
+	SymHiddenArgRangeConstraintMin     Symbol = 226   // _arg_range_constraint_min
+	SymHiddenArgRangeConstraintMax     Symbol = 227   // _arg_range_constraint_max
+	SymArgLenConstraint                Symbol = 228   // arg_len_constraint
+	SymHiddenArgLenConstraintMinOnly   Symbol = 229   // _arg_len_constraint_min_only
+	SymHiddenArgLenConstraintMaxOnly   Symbol = 230   // _arg_len_constraint_max_only
+	SymHiddenArgLenConstraintMinMax    Symbol = 231   // _arg_len_constraint_min_max
+	SymArgRequiresConstraint           Symbol = 232   // arg_requires_constraint
+	SymArgExcludesConstraint           Symbol = 233   // arg_excludes_constraint
+	SymCmdBlock                        Symbol = 234   // cmd_block
+	SymCmdDescription                  Symbol = 235   // cmd_description
+	SymCmdDescriptionContents          Symbol = 236   // cmd_description_contents
+	SymCmdCalls                        Symbol = 237   // cmd_calls
+	SymRadBlock                        Symbol = 238   // rad_block
+	SymRadKeyword                      Symbol = 239   // rad_keyword
+	SymHiddenRadStmt                   Symbol = 240   // _rad_stmt
+	SymHiddenRadSimpleStmts            Symbol = 241   // _rad_simple_stmts
+	SymRadOptionStmt                   Symbol = 242   // rad_option_stmt
+	SymRadOptionKeyword                Symbol = 243   // rad_option_keyword
+	SymRadSortStmt                     Symbol = 244   // rad_sort_stmt
+	SymRadSortSpecifier                Symbol = 245   // rad_sort_specifier
+	SymRadFieldStmt                    Symbol = 246   // rad_field_stmt
+	SymRadFieldModifierStmt            Symbol = 247   // rad_field_modifier_stmt
+	SymHiddenRadFieldModifier          Symbol = 248   // _rad_field_modifier
+	SymRadFieldModColor                Symbol = 249   // rad_field_mod_color
+	SymRadFieldModMap                  Symbol = 250   // rad_field_mod_map
+	SymRadFieldModFilter               Symbol = 251   // rad_field_mod_filter
+	SymRadIfStmt                       Symbol = 252   // rad_if_stmt
+	SymRadIfAlt                        Symbol = 253   // rad_if_alt
+	SymRadElseAlt                      Symbol = 254   // rad_else_alt
+	SymDeferBlock                      Symbol = 255   // defer_block
+	SymFnNamed                         Symbol = 256   // fn_named
+	SymFnLambda                        Symbol = 257   // fn_lambda
+	SymHiddenFnBody                    Symbol = 258   // _fn_body
+	SymHiddenFnBlock                   Symbol = 259   // _fn_block
+	SymHiddenFnParamList               Symbol = 260   // _fn_param_list
+	SymHiddenPositionalParams          Symbol = 261   // _positional_params
+	SymNormalParam                     Symbol = 262   // normal_param
+	SymVarargParam                     Symbol = 263   // vararg_param
+	SymFnParamOrReturnType             Symbol = 264   // fn_param_or_return_type
+	SymFnLeafType                      Symbol = 265   // fn_leaf_type
+	SymReturnStmt                      Symbol = 266   // return_stmt
+	SymListType                        Symbol = 267   // list_type
+	SymFnType                          Symbol = 268   // fn_type
+	SymMapType                         Symbol = 269   // map_type
+	SymNamedMapEntry                   Symbol = 270   // named_map_entry
+	SymEmptyList                       Symbol = 271   // empty_list
+	SymStringList                      Symbol = 272   // string_list
+	SymIntList                         Symbol = 273   // int_list
+	SymFloatList                       Symbol = 274   // float_list
+	SymBoolList                        Symbol = 275   // bool_list
+	SymList                            Symbol = 276   // list
+	SymMap                             Symbol = 277   // map
+	SymMapEntry                        Symbol = 278   // map_entry
+	SymString                          Symbol = 279   // string
+	SymStringContents                  Symbol = 280   // string_contents
+	SymHiddenEscapeSeq                 Symbol = 281   // _escape_seq
+	SymHiddenNotEscapeSeq              Symbol = 282   // _not_escape_seq
+	SymInterpolation                   Symbol = 283   // interpolation
+	SymFormatSpecifier                 Symbol = 284   // format_specifier
+	SymHiddenIdentifier                Symbol = 285   // _identifier
+	SymBool                            Symbol = 286   // bool
+	SymLiteral                         Symbol = 287   // literal
+	SymAuxSourceFileRepeat1            Symbol = 288   // source_file_repeat1
+	SymAuxSourceFileRepeat2            Symbol = 289   // source_file_repeat2
+	SymAuxFileHeaderContentsRepeat1    Symbol = 290   // file_header_contents_repeat1
+	SymAuxIndexedExprRepeat1           Symbol = 291   // indexed_expr_repeat1
+	SymAuxCallArgListRepeat1           Symbol = 292   // _call_arg_list_repeat1
+	SymAuxCallArgListRepeat2           Symbol = 293   // _call_arg_list_repeat2
+	SymAuxLeftSideRepeat1              Symbol = 294   // _left_side_repeat1
+	SymAuxRightSideRepeat1             Symbol = 295   // _right_side_repeat1
+	SymAuxJsonPathRepeat1              Symbol = 296   // json_path_repeat1
+	SymAuxJsonOpenerRepeat1            Symbol = 297   // json_opener_repeat1
+	SymAuxDelStmtRepeat1               Symbol = 298   // del_stmt_repeat1
+	SymAuxIfStmtRepeat1                Symbol = 299   // if_stmt_repeat1
+	SymAuxForLeftsRepeat1              Symbol = 300   // for_lefts_repeat1
+	SymAuxSwitchStmtRepeat1            Symbol = 301   // switch_stmt_repeat1
+	SymAuxSwitchCaseRepeat1            Symbol = 302   // switch_case_repeat1
+	SymAuxShellCmdRepeat1              Symbol = 303   // shell_cmd_repeat1
+	SymAuxArgBlockRepeat1              Symbol = 304   // arg_block_repeat1
+	SymAuxIntArgRepeat1                Symbol = 305   // int_arg_repeat1
+	SymAuxArgRequiresConstraintRepeat1 Symbol = 306   // arg_requires_constraint_repeat1
+	SymAuxArgExcludesConstraintRepeat1 Symbol = 307   // arg_excludes_constraint_repeat1
+	SymAuxCmdBlockRepeat1              Symbol = 308   // cmd_block_repeat1
+	SymAuxRadBlockRepeat1              Symbol = 309   // rad_block_repeat1
+	SymAuxRadSortStmtRepeat1           Symbol = 310   // rad_sort_stmt_repeat1
+	SymAuxRadFieldStmtRepeat1          Symbol = 311   // rad_field_stmt_repeat1
+	SymAuxRadFieldModifierStmtRepeat1  Symbol = 312   // rad_field_modifier_stmt_repeat1
+	SymAuxRadIfStmtRepeat1             Symbol = 313   // rad_if_stmt_repeat1
+	SymAuxFnParamListRepeat1           Symbol = 314   // _fn_param_list_repeat1
+	SymAuxPositionalParamsRepeat1      Symbol = 315   // _positional_params_repeat1
+	SymAuxFnParamOrReturnTypeRepeat1   Symbol = 316   // fn_param_or_return_type_repeat1
+	SymAuxFnLeafTypeRepeat1            Symbol = 317   // fn_leaf_type_repeat1
+	SymAuxListTypeRepeat1              Symbol = 318   // list_type_repeat1
+	SymAuxListTypeRepeat2              Symbol = 319   // list_type_repeat2
+	SymAuxFnTypeRepeat1                Symbol = 320   // fn_type_repeat1
+	SymAuxMapTypeRepeat1               Symbol = 321   // map_type_repeat1
+	SymAuxStringListRepeat1            Symbol = 322   // string_list_repeat1
+	SymAuxIntListRepeat1               Symbol = 323   // int_list_repeat1
+	SymAuxFloatListRepeat1             Symbol = 324   // float_list_repeat1
+	SymAuxBoolListRepeat1              Symbol = 325   // bool_list_repeat1
+	SymAuxListRepeat1                  Symbol = 326   // list_repeat1
+	SymAuxMapRepeat1                   Symbol = 327   // map_repeat1
+	SymAuxStringContentsRepeat1        Symbol = 328   // string_contents_repeat1
+	SymError                           Symbol = 65535 // ERROR
+)
+
+const (
+	FieldAlignment          Field = 1
+	FieldAlt                Field = 2
+	FieldAny                Field = 3
+	FieldArg                Field = 4
+	FieldArgName            Field = 5
+	FieldBackslash          Field = 6
+	FieldBacktick           Field = 7
+	FieldBlockColon         Field = 8
+	FieldCallbackIdentifier Field = 9
+	FieldCallbackLambda     Field = 10
+	FieldCalls              Field = 11
+	FieldCase               Field = 12
+	FieldCaseKey            Field = 13
+	FieldCatch              Field = 14
+	FieldCloseBracket       Field = 15
+	FieldCloser             Field = 16
+	FieldColor              Field = 17
+	FieldCommand            Field = 18
+	FieldComment            Field = 19
+	FieldCondition          Field = 20
+	FieldContent            Field = 21
+	FieldContents           Field = 22
+	FieldContext            Field = 23
+	FieldDeclaration        Field = 24
+	FieldDeclaredType       Field = 25
+	FieldDefault            Field = 26
+	FieldDelegate           Field = 27
+	FieldDescription        Field = 28
+	FieldDiscriminant       Field = 29
+	FieldDoubleQuote        Field = 30
+	FieldEnd                Field = 31
+	FieldEnum               Field = 32
+	FieldEnumConstraint     Field = 33
+	FieldExcluded           Field = 34
+	FieldExcludes           Field = 35
+	FieldExcludesConstraint Field = 36
+	FieldExpr               Field = 37
+	FieldFalseBranch        Field = 38
+	FieldFillAlignment      Field = 39
+	FieldFirst              Field = 40
+	FieldFormat             Field = 41
+	FieldFunc               Field = 42
+	FieldGroup              Field = 43
+	FieldIdentifier         Field = 44
+	FieldIndex              Field = 45
+	FieldIndexing           Field = 46
+	FieldInterpolation      Field = 47
+	FieldKey                Field = 48
+	FieldKeyName            Field = 49
+	FieldKeyType            Field = 50
+	FieldKeyword            Field = 51
+	FieldLambda             Field = 52
+	FieldLeafType           Field = 53
+	FieldLeft               Field = 54
+	FieldLefts              Field = 55
+	FieldLenConstraint      Field = 56
+	FieldList               Field = 57
+	FieldListEntry          Field = 58
+	FieldMapEntry           Field = 59
+	FieldMax                Field = 60
+	FieldMin                Field = 61
+	FieldModStmt            Field = 62
+	FieldModifier           Field = 63
+	FieldMutually           Field = 64
+	FieldName               Field = 65
+	FieldNamedArg           Field = 66
+	FieldNamedEntry         Field = 67
+	FieldNamedOnlyParam     Field = 68
+	FieldNewline            Field = 69
+	FieldNormalParam        Field = 70
+	FieldOp                 Field = 71
+	FieldOpenBracket        Field = 72
+	FieldOpener             Field = 73
+	FieldOptional           Field = 74
+	FieldPadding            Field = 75
+	FieldParam              Field = 76
+	FieldPrecision          Field = 77
+	FieldRadType            Field = 78
+	FieldRangeConstraint    Field = 79
+	FieldRegex              Field = 80
+	FieldRegexConstraint    Field = 81
+	FieldRename             Field = 82
+	FieldRequired           Field = 83
+	FieldRequires           Field = 84
+	FieldRequiresConstraint Field = 85
+	FieldReturnType         Field = 86
+	FieldRight              Field = 87
+	FieldRoot               Field = 88
+	FieldSecond             Field = 89
+	FieldSegment            Field = 90
+	FieldShorthand          Field = 91
+	FieldSingleQuote        Field = 92
+	FieldSource             Field = 93
+	FieldSpecifier          Field = 94
+	FieldStart              Field = 95
+	FieldStmt               Field = 96
+	FieldTab                Field = 97
+	FieldThousandsSeparator Field = 98
+	FieldTrueBranch         Field = 99
+	FieldType               Field = 100
+	FieldValue              Field = 101
+	FieldValueType          Field = 102
+	FieldValues             Field = 103
+	FieldVarargMarker       Field = 104
+	FieldVarargParam        Field = 105
+	FieldVariadicMarker     Field = 106
+)
@@ -0,0 +1,43 @@
+package tree_sitter_rad
+
+import (
+	"fmt"
+	"hash/fnv"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+// Symbol is a node kind id as returned by Node.KindId. The constants in
+// symbols.go (generated by gen_symbols_test.go) cover every id in the grammar.
+// Node.KindId reports the public id of aliased symbols, so hidden, auxiliary
+// and aliased ids never show up there; switch on the named kinds instead of
+// comparing Node.Kind strings.
+type Symbol uint16
+
+// Field is a field id as returned by TreeCursor.FieldId or FlatNode.FieldId.
+type Field uint16
+
+// CheckSymbols reports whether language has exactly the symbols and fields
+// that the generated constants describe.
+func CheckSymbols(language *tree_sitter.Language) error {
+	symbolCount := int(language.NodeKindCount())
+	fieldCount := int(language.FieldCount())
+	if symbolCount != SymbolCount || fieldCount != FieldCount {
+		return fmt.Errorf("tree-sitter-rad: parser has %d symbols and %d fields, constants expect %d and %d; regenerate symbols.go",
+			symbolCount, fieldCount, SymbolCount, FieldCount)
+	}
+
+	hash := fnv.New64a()
+	for i := 0; i < symbolCount; i++ {
+		hash.Write([]byte(language.NodeKindForId(uint16(i))))
+		hash.Write([]byte{0})
+	}
+	for i := 1; i <= fieldCount; i++ {
+		hash.Write([]byte(language.FieldNameForId(uint16(i))))
+		hash.Write([]byte{0})
+	}
+	if hash.Sum64() != SymbolHash {
+		return fmt.Errorf("tree-sitter-rad: parser symbol names don't match the generated constants; regenerate symbols.go")
+	}
+	return nil
+}
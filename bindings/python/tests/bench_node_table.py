@@ -0,0 +1,102 @@
+"""Query benchmark: node objects versus node_table() columns.
+
+    python bindings/python/tests/bench_node_table.py [--nodes N] [--func NAME]
+
+Finds every call whose func is NAME in a script of at least N nodes, built by
+repeating bench/corpus/functions.rad. The object API walks tree_sitter.Node
+objects; the table path exports the tree with node_table() and filters the
+columns with NumPy, or with plain loops when NumPy isn't installed. The
+table timings include the export.
+"""
+
+import argparse
+import time
+from pathlib import Path
+
+import tree_sitter
+import tree_sitter_rad
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+ROOT = Path(__file__).resolve().parents[3]
+LANGUAGE = tree_sitter.Language(tree_sitter_rad.language())
+CALL = LANGUAGE.id_for_node_kind("call", True)
+FUNC = LANGUAGE.field_id_for_name("func")
+
+
+def with_objects(tree, name):
+    found = []
+    stack = [tree.root_node]
+    while stack:
+        node = stack.pop()
+        if node.kind_id == CALL and node.child_by_field_name("func").text == name:
+            found.append(node.start_byte)
+        stack.extend(node.children)
+    return sorted(found)
+
+
+def with_numpy(source, name):
+    table = tree_sitter_rad.node_table(source)
+    kinds = numpy.asarray(table.kind_id)
+    fields = numpy.asarray(table.field_id)
+    parents = numpy.asarray(table.parent)
+    starts = numpy.asarray(table.start_byte)
+    ends = numpy.asarray(table.end_byte)
+
+    funcs = numpy.flatnonzero((fields == FUNC) & (ends - starts == len(name)))
+    funcs = funcs[kinds[parents[funcs]] == CALL]
+    matches = [i for i in funcs if source[starts[i]:ends[i]] == name]
+    return sorted(int(starts[parents[i]]) for i in matches)
+
+
+def with_loops(source, name):
+    table = tree_sitter_rad.node_table(source)
+    kinds, parents = table.kind_id, table.parent
+    starts, ends = table.start_byte, table.end_byte
+    found = []
+    for i, field in enumerate(table.field_id):
+        if field == FUNC and kinds[parents[i]] == CALL and source[starts[i]:ends[i]] == name:
+            found.append(starts[parents[i]])
+    return sorted(found)
+
+
+def best(fn, *args, repeat):
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        result = fn(*args)
+        times.append(time.perf_counter() - start)
+    return min(times), result
+
+
+def main():
+    args = argparse.ArgumentParser()
+    args.add_argument("--nodes", type=int, default=50_000)
+    args.add_argument("--func", default="describe")
+    args.add_argument("--repeat", type=int, default=5)
+    opts = args.parse_args()
+
+    unit = (ROOT / "bench" / "corpus" / "functions.rad").read_bytes()
+    source = unit
+    while len(tree_sitter_rad.node_table(source)) < opts.nodes:
+        source += unit
+    name = opts.func.encode()
+    tree = tree_sitter.Parser(LANGUAGE).parse(source)
+    print(f"{len(tree_sitter_rad.node_table(source))} nodes, {len(source)} bytes")
+
+    objects, expected = best(with_objects, tree, name, repeat=opts.repeat)
+    print(f"{'node objects':>20} {objects * 1e3:8.2f} ms")
+    variants = [("node_table + loops", with_loops)]
+    if numpy is not None:
+        variants.append(("node_table + numpy", with_numpy))
+    for label, fn in variants:
+        elapsed, found = best(fn, source, name, repeat=opts.repeat)
+        assert found == expected, f"{label} found {len(found)} calls, expected {len(expected)}"
+        print(f"{label:>20} {elapsed * 1e3:8.2f} ms {objects / elapsed:6.1f}x")
+
+
+if __name__ == "__main__":
+    main()
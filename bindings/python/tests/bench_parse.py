@@ -0,0 +1,145 @@
+"""pytest-benchmark suite for comparing grammar versions.
+
+    pip install '.[bench]'
+    pytest bindings/python/tests/bench_parse.py --benchmark-json=bench-old.json
+    # install the other version, then
+    pytest bindings/python/tests/bench_parse.py --benchmark-json=bench-new.json
+    pytest-benchmark compare bench-old.json bench-new.json
+
+Sources come from bench/corpus, or RAD_BENCH_CORPUS for the per-file cases.
+"""
+
+import os
+import re
+from pathlib import Path
+
+import pytest
+import tree_sitter
+import tree_sitter_rad
+
+ROOT = Path(__file__).resolve().parents[3]
+CORPUS = Path(os.environ.get("RAD_BENCH_CORPUS", ROOT / "bench" / "corpus"))
+LANGUAGE = tree_sitter.Language(tree_sitter_rad.language())
+
+# functions.rad has no preamble, so it stays a valid script when repeated.
+UNIT = (ROOT / "bench" / "corpus" / "functions.rad").read_bytes()
+SIZES = {"1KiB": 1 << 10, "16KiB": 16 << 10, "256KiB": 256 << 10, "1MiB": 1 << 20}
+
+
+def sized(size):
+    return UNIT * -(-size // len(UNIT))
+
+
+def point_at(source, offset):
+    row = source.count(b"\n", 0, offset)
+    return row, offset - (source.rfind(b"\n", 0, offset) + 1)
+
+
+@pytest.fixture
+def parser():
+    return tree_sitter.Parser(LANGUAGE)
+
+
+def record(benchmark, source, tree):
+    benchmark.extra_info["bytes"] = len(source)
+    benchmark.extra_info["nodes"] = tree.root_node.descendant_count
+
+
+@pytest.mark.parametrize("size", SIZES)
+def test_parse_size(benchmark, parser, size):
+    source = sized(SIZES[size])
+    tree = benchmark(parser.parse, source)
+    record(benchmark, source, tree)
+
+
+@pytest.mark.parametrize("path", sorted(CORPUS.rglob("*.rad")), ids=lambda p: p.name)
+def test_parse_corpus(benchmark, parser, path):
+    source = path.read_bytes()
+    tree = benchmark(parser.parse, source)
+    record(benchmark, source, tree)
+
+
+def read_edits():
+    """The reparse edits in bench/corpus/edits.tsv, shared with the other
+    bindings' benchmarks."""
+    escapes = {"n": "\n", "t": "\t", "\\": "\\"}
+    edits = {}
+    for line in (ROOT / "bench" / "corpus" / "edits.tsv").read_text().splitlines():
+        if not line or line.startswith("#"):
+            continue
+        name, anchor, insert = (
+            re.sub(r"\\(.)", lambda m: escapes.get(m[1], m[1]), field).encode()
+            for field in line.split("\t")
+        )
+        edits[name.decode()] = (anchor, insert)
+    return edits
+
+
+# Each edit inserts text just before the first match of its anchor past the
+# middle of a 256 KiB script.
+EDITS = read_edits()
+
+
+@pytest.mark.parametrize("edit", EDITS)
+def test_reparse(benchmark, parser, edit):
+    anchor, insert = EDITS[edit]
+    source = sized(256 << 10)
+    at = source.index(anchor, len(source) // 2)
+    new_source = source[:at] + insert + source[at:]
+    tree = parser.parse(source)
+
+    def edited():
+        old = tree.copy()
+        old.edit(
+            start_byte=at,
+            old_end_byte=at,
+            new_end_byte=at + len(insert),
+            start_point=point_at(source, at),
+            old_end_point=point_at(source, at),
+            new_end_point=point_at(new_source, at + len(insert)),
+        )
+        return (new_source, old), {}
+
+    new_tree = benchmark.pedantic(parser.parse, setup=edited, rounds=200)
+    record(benchmark, new_source, new_tree)
+
+
+# Traversals visit every node and read its kind and byte range.
+
+
+def walk_nodes(node):
+    total = node.kind_id + node.start_byte + node.end_byte
+    for child in node.children:
+        total += walk_nodes(child)
+    return total
+
+
+def walk_cursor(tree):
+    cursor = tree.walk()
+    total = 0
+    while True:
+        node = cursor.node
+        total += node.kind_id + node.start_byte + node.end_byte
+        if cursor.goto_first_child():
+            continue
+        while not cursor.goto_next_sibling():
+            if not cursor.goto_parent():
+                return total
+
+
+@pytest.fixture(scope="module")
+def traversal_tree():
+    source = sized(64 << 10)
+    return source, tree_sitter.Parser(LANGUAGE).parse(source)
+
+
+def test_traverse_nodes(benchmark, traversal_tree):
+    source, tree = traversal_tree
+    benchmark(walk_nodes, tree.root_node)
+    record(benchmark, source, tree)
+
+
+def test_traverse_cursor(benchmark, traversal_tree):
+    source, tree = traversal_tree
+    assert benchmark(walk_cursor, tree) == walk_nodes(tree.root_node)
+    record(benchmark, source, tree)
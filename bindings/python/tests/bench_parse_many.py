@@ -0,0 +1,53 @@
+"""Scaling benchmark for parse_many().
+
+    python bindings/python/tests/bench_parse_many.py [--copies N] [--corpus DIR]
+
+Parses the corpus `copies` times over with 1, 2, 4, ... threads up to the CPU
+count and prints throughput and speedup over one thread. Parsing shares no
+state between workers, so speedup should stay close to the thread count until
+memory bandwidth runs out.
+"""
+
+import argparse
+import os
+import time
+from pathlib import Path
+
+import tree_sitter_rad
+
+ROOT = Path(__file__).resolve().parents[3]
+
+
+def main():
+    args = argparse.ArgumentParser()
+    args.add_argument("--corpus", default=os.environ.get("RAD_BENCH_CORPUS", ROOT / "bench" / "corpus"))
+    args.add_argument("--copies", type=int, default=200)
+    args.add_argument("--repeat", type=int, default=5)
+    opts = args.parse_args()
+
+    sources = [path.read_bytes() for path in sorted(Path(opts.corpus).rglob("*.rad"))] * opts.copies
+    size = sum(map(len, sources))
+    cpus = os.cpu_count() or 1
+    threads = [1]
+    while threads[-1] * 2 <= cpus:
+        threads.append(threads[-1] * 2)
+    if threads[-1] != cpus:
+        threads.append(cpus)
+
+    print(f"{len(sources)} files, {size / 1e6:.1f} MB")
+    print(f"{'threads':>7} {'files/s':>10} {'MB/s':>8} {'speedup':>8}")
+    baseline = None
+    for n in threads:
+        best = min(timed(sources, n) for _ in range(opts.repeat))
+        baseline = baseline or best
+        print(f"{n:>7} {len(sources) / best:>10.0f} {size / best / 1e6:>8.1f} {baseline / best:>7.2f}x")
+
+
+def timed(sources, threads):
+    start = time.perf_counter()
+    tree_sitter_rad.parse_many(sources, threads=threads)
+    return time.perf_counter() - start
+
+
+if __name__ == "__main__":
+    main()
@@ -1,11 +1,86 @@
-from unittest import TestCase
+from threading import Event, Thread
+from unittest import TestCase, skipUnless
 
 import tree_sitter, tree_sitter_rad
 
 
+def _has_runtime():
+    try:
+        tree_sitter_rad.node_table(b"")
+    except RuntimeError:
+        return False
+    return True
+
+
 class TestLanguage(TestCase):
     def test_can_load_grammar(self):
         try:
             tree_sitter.Language(tree_sitter_rad.language())
         except Exception:
             self.fail("Error loading Rad grammar")
+
+
+@skipUnless(_has_runtime(), "built without the tree-sitter C library")
+class TestParseMany(TestCase):
+    def test_matches_cursor(self):
+        sources = [b"a = 1\nprint(a)\n", b"fn f(x):\n    return x\n", b""]
+        parser = tree_sitter.Parser(tree_sitter.Language(tree_sitter_rad.language()))
+
+        tables = tree_sitter_rad.parse_many(sources, threads=2)
+        self.assertEqual(len(tables), len(sources))
+        for source, table in zip(sources, tables):
+            expected = []
+            cursor = parser.parse(source).walk()
+            while True:
+                node = cursor.node
+                expected.append((node.kind_id, cursor.field_id or 0, node.start_byte, node.end_byte))
+                if cursor.goto_first_child():
+                    continue
+                while not cursor.goto_next_sibling():
+                    if not cursor.goto_parent():
+                        break
+                else:
+                    continue
+                break
+
+            columns = zip(table.kind_id, table.field_id, table.start_byte, table.end_byte)
+            self.assertEqual(list(columns), expected)
+            self.assertEqual(table.parent[0], tree_sitter_rad.NO_NODE)
+
+    def test_node_table_parents(self):
+        source = b"fn f(x):\n    return x\n"
+        table = tree_sitter_rad.node_table(source)
+        root = tree_sitter.Parser(tree_sitter.Language(tree_sitter_rad.language())).parse(source).root_node
+
+        def visit(node, parent, index):
+            self.assertEqual(table.parent[index], parent)
+            self.assertEqual(table.kind_id[index], node.kind_id)
+            child_index = index + 1
+            for child in node.children:
+                child_index = visit(child, index, child_index)
+            return child_index
+
+        self.assertEqual(visit(root, tree_sitter_rad.NO_NODE, 0), len(table))
+
+    def test_rejects_str(self):
+        with self.assertRaises(TypeError):
+            tree_sitter_rad.parse_many(["a = 1"])
+
+    def test_list_changes_during_parse(self):
+        sources = [b"a = 1\n" * 20000 for _ in range(16)]
+        expected = len(tree_sitter_rad.node_table(sources[0]))
+        done = Event()
+
+        def mutate():
+            while not done.is_set():
+                for i in range(len(sources)):
+                    sources[i] = b"a = 1\n" * 20000
+
+        thread = Thread(target=mutate)
+        thread.start()
+        try:
+            tables = tree_sitter_rad.parse_many(sources, threads=4)
+        finally:
+            done.set()
+            thread.join()
+        self.assertEqual([len(table) for table in tables], [expected] * len(tables))
@@ -0,0 +1,43 @@
+import ctypes
+import os
+import time
+from pathlib import Path
+from unittest import TestCase, skipUnless
+
+import tree_sitter, tree_sitter_rad
+
+ROOT = Path(__file__).resolve().parents[3]
+C_LIBRARY = os.environ.get("TREE_SITTER_RAD_LIB")
+
+
+def c_language(path):
+    """Loads the grammar from a shared library built by make or CMake."""
+    library = ctypes.CDLL(path)
+    library.tree_sitter_rad.restype = ctypes.c_void_p
+    capsule_new = ctypes.pythonapi.PyCapsule_New
+    capsule_new.restype = ctypes.py_object
+    capsule_new.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_void_p]
+    return capsule_new(library.tree_sitter_rad(), b"tree_sitter.Language", None)
+
+
+def parse_seconds(language, source, repeat=10):
+    parser = tree_sitter.Parser(tree_sitter.Language(language))
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        parser.parse(source)
+        times.append(time.perf_counter() - start)
+    return min(times)
+
+
+@skipUnless(C_LIBRARY, "set TREE_SITTER_RAD_LIB to libtree-sitter-rad.so to compare against the C build")
+class TestThroughput(TestCase):
+    def test_not_slower_than_c_library(self):
+        # Both sides run the same runtime, so any difference comes from how
+        # parser.c and scanner.c were compiled.
+        source = (ROOT / "bench" / "corpus" / "functions.rad").read_bytes() * 200
+        wheel = parse_seconds(tree_sitter_rad.language(), source)
+        native = parse_seconds(c_language(C_LIBRARY), source)
+        self.assertLess(wheel, native * 1.15,
+                        f"extension parses at {len(source) / wheel / 1e6:.1f} MB/s, "
+                        f"C library at {len(source) / native / 1e6:.1f} MB/s")
@@ -3,6 +3,7 @@
 from importlib.resources import files as _files
 
 from ._binding import language
+from ._nodes import NO_NODE, NodeTable, node_table, parse_many
 
 
 def _get_query(name, file):
@@ -28,13 +29,16 @@ def __getattr__(name):
 
 __all__ = [
     "language",
+    "NO_NODE",
+    "NodeTable",
+    "node_table",
+    "parse_many",
     # "HIGHLIGHTS_QUERY",
     # "INJECTIONS_QUERY",
     # "LOCALS_QUERY",
     # "TAGS_QUERY",
 ]
 
-
 def __dir__():
     return sorted(__all__ + [
         "__all__", "__builtins__", "__cached__", "__doc__", "__file__",
@@ -1,4 +1,4 @@
-from typing import Final
+from typing import Final, Sequence
 
 # NOTE: uncomment these to include any queries that this grammar contains:
 
@@ -8,3 +8,28 @@ from typing import Final
 # TAGS_QUERY: Final[str]
 
 def language() -> object: ...
+
+# Parsing needs the tree-sitter C library; if the extension was built without
+# it, node_table() and parse_many() raise RuntimeError.
+
+NO_NODE: Final[int]
+
+class NodeTable:
+    """A parsed tree as struct-of-arrays, one entry per node in pre-order.
+    Columns are typed memoryviews, so numpy.asarray() wraps them without
+    copying."""
+
+    kind_id: memoryview
+    field_id: memoryview
+    parent: memoryview
+    start_byte: memoryview
+    end_byte: memoryview
+
+    def __len__(self) -> int: ...
+    def columns(self) -> dict[str, memoryview]: ...
+
+def node_table(source: bytes) -> NodeTable: ...
+
+def parse_many(sources: Sequence[bytes], threads: int = 0) -> list[NodeTable]:
+    """Parse every source on up to `threads` native threads (0 means one per
+    CPU) with the GIL released."""
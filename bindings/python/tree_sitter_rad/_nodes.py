@@ -0,0 +1,49 @@
+from ._binding import node_table as _node_table, parse_many as _parse_many
+
+NO_NODE = 0xFFFFFFFF
+
+
+class NodeTable:
+    """A parsed tree as struct-of-arrays, one entry per node in pre-order.
+
+    Every column is a typed memoryview, so it supports the buffer protocol and
+    `numpy.asarray(table.kind_id)` wraps it without copying:
+
+        kinds = numpy.asarray(table.kind_id)
+        parents = numpy.asarray(table.parent)
+        calls = numpy.flatnonzero(kinds == call_id)
+        funcs = numpy.flatnonzero((numpy.asarray(table.field_id) == func_id)
+                                  & numpy.isin(parents, calls))
+
+    Kind and field ids are the ones tree_sitter.Language reports, e.g.
+    `language.id_for_node_kind("call", True)` and `language.field_id_for_name("func")`.
+    """
+
+    __slots__ = ("kind_id", "field_id", "parent", "start_byte", "end_byte")
+
+    def __init__(self, kind_id, field_id, parent, start_byte, end_byte):
+        # uint16 kind and field ids; uint32 parent index (NO_NODE for the
+        # root) and byte range.
+        self.kind_id = memoryview(kind_id).cast("H")
+        self.field_id = memoryview(field_id).cast("H")
+        self.parent = memoryview(parent).cast("I")
+        self.start_byte = memoryview(start_byte).cast("I")
+        self.end_byte = memoryview(end_byte).cast("I")
+
+    def __len__(self):
+        return len(self.kind_id)
+
+    def columns(self):
+        """Returns the columns by name, e.g. for building a DataFrame."""
+        return {name: getattr(self, name) for name in self.__slots__}
+
+
+def node_table(source):
+    """Parses source, which must be bytes, into a NodeTable."""
+    return NodeTable(*_node_table(source))
+
+
+def parse_many(sources, threads=0):
+    """Parses every source into a NodeTable on up to `threads` native threads,
+    one per CPU by default, without holding the GIL."""
+    return [NodeTable(*columns) for columns in _parse_many(sources, threads)]
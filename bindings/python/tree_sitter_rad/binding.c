@@ -1,4 +1,5 @@
 #include <Python.h>
+#include <stdbool.h>
 
 typedef struct TSLanguage TSLanguage;
 
@@ -8,9 +9,325 @@ static PyObject* _binding_language(PyObject *Py_UNUSED(self), PyObject *Py_UNUSE
     return PyCapsule_New(tree_sitter_rad(), "tree_sitter.Language", NULL);
 }
 
+#ifdef TREE_SITTER_RAD_RUNTIME
+
+// Native parsing needs the tree-sitter library itself, which setup.py compiles
+// in or links when it can find it.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <tree_sitter/api.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#define NO_NODE UINT32_MAX
+
+// A tree flattened to pre-order columns. All five share one allocation,
+// owned by parent.
+typedef struct {
+    uint32_t count;
+    uint32_t *parent;
+    uint32_t *start_byte;
+    uint32_t *end_byte;
+    uint16_t *kind_id;
+    uint16_t *field_id;
+} NodeTable;
+
+typedef struct {
+    const char *source;
+    uint32_t length;
+    NodeTable table;
+    bool ok;
+} ParseJob;
+
+typedef struct {
+    ParseJob *jobs;
+    long long count;
+    volatile long long next;
+} ParseBatch;
+
+static bool node_table_fill(NodeTable *table, TSNode root) {
+    uint32_t count = ts_node_descendant_count(root);
+    uint32_t *block = malloc((size_t)count * (3 * sizeof(uint32_t) + 2 * sizeof(uint16_t)));
+    if (block == NULL) {
+        return false;
+    }
+    table->parent = block;
+    table->start_byte = block + count;
+    table->end_byte = block + 2 * (size_t)count;
+    table->kind_id = (uint16_t *)(block + 3 * (size_t)count);
+    table->field_id = table->kind_id + count;
+
+    // Parent links double as the stack: leaving a subtree moves the current
+    // parent to its own parent.
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    uint32_t i = 0, parent = NO_NODE;
+    while (i < count) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        table->parent[i] = parent;
+        table->start_byte[i] = ts_node_start_byte(node);
+        table->end_byte[i] = ts_node_end_byte(node);
+        table->kind_id[i] = ts_node_symbol(node);
+        table->field_id[i] = ts_tree_cursor_current_field_id(&cursor);
+
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            parent = i++;
+            continue;
+        }
+        i++;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                goto done;
+            }
+            parent = table->parent[parent];
+        }
+    }
+done:
+    ts_tree_cursor_delete(&cursor);
+    table->count = i;
+    return true;
+}
+
+static long long batch_claim(ParseBatch *batch) {
+#ifdef _WIN32
+    return InterlockedIncrement64(&batch->next) - 1;
+#else
+    return __atomic_fetch_add(&batch->next, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+// Each worker owns one parser and takes jobs until the batch is drained, so
+// a few large sources can't leave the other threads idle.
+#ifdef _WIN32
+static DWORD WINAPI parse_worker(LPVOID arg) {
+#else
+static void *parse_worker(void *arg) {
+#endif
+    ParseBatch *batch = arg;
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_rad());
+    for (long long i = batch_claim(batch); i < batch->count; i = batch_claim(batch)) {
+        ParseJob *job = &batch->jobs[i];
+        TSTree *tree = ts_parser_parse_string(parser, NULL, job->source, job->length);
+        if (tree == NULL) {
+            ts_parser_reset(parser);
+            continue;
+        }
+        job->ok = node_table_fill(&job->table, ts_tree_root_node(tree));
+        ts_tree_delete(tree);
+    }
+    ts_parser_delete(parser);
+    return 0;
+}
+
+static long cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (long)info.dwNumberOfProcessors;
+#else
+    return sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
+
+// Runs parse_worker on the calling thread plus threads - 1 others.
+static void parse_batch(ParseBatch *batch, long threads) {
+#ifdef _WIN32
+    HANDLE *handles = calloc((size_t)threads, sizeof(HANDLE));
+    for (long t = 1; handles != NULL && t < threads; t++) {
+        handles[t] = CreateThread(NULL, 0, parse_worker, batch, 0, NULL);
+    }
+    parse_worker(batch);
+    for (long t = 1; handles != NULL && t < threads; t++) {
+        if (handles[t] != NULL) {
+            WaitForSingleObject(handles[t], INFINITE);
+            CloseHandle(handles[t]);
+        }
+    }
+    free(handles);
+#else
+    pthread_t *workers = calloc((size_t)threads, sizeof(pthread_t));
+    bool *started = calloc((size_t)threads, sizeof(bool));
+    for (long t = 1; workers != NULL && started != NULL && t < threads; t++) {
+        started[t] = pthread_create(&workers[t], NULL, parse_worker, batch) == 0;
+    }
+    parse_worker(batch);
+    for (long t = 1; workers != NULL && started != NULL && t < threads; t++) {
+        if (started[t]) {
+            pthread_join(workers[t], NULL);
+        }
+    }
+    free(workers);
+    free(started);
+#endif
+}
+
+static PyObject *node_table_to_python(const NodeTable *table) {
+    Py_ssize_t count = table->count;
+    return Py_BuildValue(
+        "(y#y#y#y#y#)",
+        (const char *)table->kind_id, count * (Py_ssize_t)sizeof(uint16_t),
+        (const char *)table->field_id, count * (Py_ssize_t)sizeof(uint16_t),
+        (const char *)table->parent, count * (Py_ssize_t)sizeof(uint32_t),
+        (const char *)table->start_byte, count * (Py_ssize_t)sizeof(uint32_t),
+        (const char *)table->end_byte, count * (Py_ssize_t)sizeof(uint32_t)
+    );
+}
+
+// The workers can't raise, so check up front that the linked runtime supports
+// this grammar's ABI.
+static bool check_runtime(void) {
+    TSParser *probe = ts_parser_new();
+    bool compatible = ts_parser_set_language(probe, tree_sitter_rad());
+    ts_parser_delete(probe);
+    if (!compatible) {
+        PyErr_Format(PyExc_RuntimeError, "the linked tree-sitter library can't load this grammar (ABI %u)",
+                     ts_language_version(tree_sitter_rad()));
+    }
+    return compatible;
+}
+
+static PyObject* _binding_parse_many(PyObject *Py_UNUSED(self), PyObject *args, PyObject *kwargs) {
+    static char *keywords[] = {"sources", "threads", NULL};
+    PyObject *sources;
+    long threads = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|l", keywords, &sources, &threads)) {
+        return NULL;
+    }
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError, "threads must not be negative");
+        return NULL;
+    }
+    if (!check_runtime()) {
+        return NULL;
+    }
+
+    // A tuple snapshot holds a reference to every source, so another thread
+    // replacing items of a list can't free them while the workers parse.
+    PyObject *seq = PySequence_Tuple(sources);
+    if (seq == NULL) {
+        return NULL;
+    }
+    Py_ssize_t count = PyTuple_Size(seq);
+    ParseJob *jobs = PyMem_Calloc(count > 0 ? (size_t)count : 1, sizeof(ParseJob));
+    if (jobs == NULL) {
+        Py_DECREF(seq);
+        return PyErr_NoMemory();
+    }
+    for (Py_ssize_t i = 0; i < count; i++) {
+        // Bytes can't change under the workers while the GIL is released.
+        PyObject *source = PyTuple_GetItem(seq, i);
+        char *data;
+        Py_ssize_t length;
+        if (source == NULL || PyBytes_AsStringAndSize(source, &data, &length) < 0) {
+            PyMem_Free(jobs);
+            Py_DECREF(seq);
+            return NULL;
+        }
+        if (length > UINT32_MAX) {
+            PyErr_Format(PyExc_ValueError, "source %zd is larger than 4 GiB", i);
+            PyMem_Free(jobs);
+            Py_DECREF(seq);
+            return NULL;
+        }
+        jobs[i].source = data;
+        jobs[i].length = (uint32_t)length;
+    }
+
+    if (threads == 0) {
+        threads = cpu_count();
+    }
+    if (threads > count) {
+        threads = (long)count;
+    }
+    ParseBatch batch = {.jobs = jobs, .count = count, .next = 0};
+    Py_BEGIN_ALLOW_THREADS
+    parse_batch(&batch, threads > 0 ? threads : 1);
+    Py_END_ALLOW_THREADS
+
+    PyObject *result = PyList_New(count);
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject *table = NULL;
+        if (result != NULL && jobs[i].ok) {
+            table = node_table_to_python(&jobs[i].table);
+        } else if (result != NULL) {
+            PyErr_Format(PyExc_RuntimeError, "parsing source %zd failed", i);
+        }
+        if (table == NULL) {
+            Py_CLEAR(result);
+        } else {
+            PyList_SetItem(result, i, table);
+        }
+        free(jobs[i].table.parent);
+    }
+    PyMem_Free(jobs);
+    Py_DECREF(seq);
+    return result;
+}
+
+static PyObject* _binding_node_table(PyObject *Py_UNUSED(self), PyObject *source) {
+    char *data;
+    Py_ssize_t length;
+    if (!check_runtime() || PyBytes_AsStringAndSize(source, &data, &length) < 0) {
+        return NULL;
+    }
+    if (length > UINT32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "source is larger than 4 GiB");
+        return NULL;
+    }
+
+    ParseJob job = {.source = data, .length = (uint32_t)length};
+    ParseBatch batch = {.jobs = &job, .count = 1, .next = 0};
+    Py_BEGIN_ALLOW_THREADS
+    parse_worker(&batch);
+    Py_END_ALLOW_THREADS
+
+    PyObject *result = NULL;
+    if (job.ok) {
+        result = node_table_to_python(&job.table);
+    } else {
+        PyErr_SetString(PyExc_RuntimeError, "parsing the source failed");
+    }
+    free(job.table.parent);
+    return result;
+}
+
+#else
+
+// Built without the tree-sitter library: parse_many() and node_table() still
+// exist, so callers get an explanation instead of an AttributeError.
+static bool check_runtime(void) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "tree-sitter-rad was built without the tree-sitter C library; reinstall with "
+                    "TREE_SITTER_RUNTIME_DIR set to a tree-sitter checkout or with the library on pkg-config");
+    return false;
+}
+
+static PyObject* _binding_parse_many(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args),
+                                     PyObject *Py_UNUSED(kwargs)) {
+    check_runtime();
+    return NULL;
+}
+
+static PyObject* _binding_node_table(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(source)) {
+    check_runtime();
+    return NULL;
+}
+
+#endif
+
 static PyMethodDef methods[] = {
     {"language", _binding_language, METH_NOARGS,
      "Get the tree-sitter language for this grammar."},
+    {"parse_many", (PyCFunction)(void (*)(void))_binding_parse_many, METH_VARARGS | METH_KEYWORDS,
+     "Parse many sources on native threads without holding the GIL."},
+    {"node_table", _binding_node_table, METH_O,
+     "Parse a source into node table columns."},
     {NULL, NULL, 0, NULL}
 };
 
@@ -0,0 +1,305 @@
+//! Lowering of a Rad tree into an arena-allocated AST, enabled by the `ast`
+//! feature.
+//!
+//! The AST keeps the named nodes of the tree and drops punctuation and
+//! keywords. It also drops the wrapper nodes that only hold a `delegate`
+//! field: `a` parses as `expr > ternary_expr > or_expr > ... > var_path`, and
+//! lowers to the `var_path` alone, which takes over the `expr`'s field.
+//! Identifiers are interned.
+//!
+//! Nodes are index-linked records in one slice. Everything a lowered tree owns
+//! lives in the [`Bump`] it was lowered into, so dropping the arena frees the
+//! whole tree. An arena from [`arena_for`] is sized to hold it in a single
+//! chunk, which makes that one deallocation.
+//!
+//! ```
+//! let mut parser = tree_sitter::Parser::new();
+//! parser.set_language(&tree_sitter_rad::LANGUAGE.into()).unwrap();
+//! let source = "total = total + 1\n";
+//! let tree = parser.parse(source, None).unwrap();
+//!
+//! let arena = tree_sitter_rad::ast::arena_for(&tree, source.as_bytes());
+//! let ast = tree_sitter_rad::ast::Lowerer::new().lower(&tree, source.as_bytes(), &arena);
+//! assert_eq!(ast.names().len(), 1);
+//! ```
+
+use std::collections::HashMap;
+
+use bumpalo::Bump;
+use tree_sitter::Tree;
+
+use crate::kinds::{Field, NodeKind};
+
+/// Marks a missing parent, first child or next sibling.
+pub const NO_NODE: u32 = u32::MAX;
+
+/// An interned identifier; look its text up with [`Ast::name`].
+#[derive(Clone, Copy, Debug, PartialEq, Eq, Hash)]
+pub struct Ident(u32);
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum AstKind {
+    Node(NodeKind),
+    Identifier(Ident),
+}
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct AstNode {
+    pub kind: AstKind,
+    /// The field the node holds in its AST parent. A node that replaced a
+    /// delegate wrapper holds the wrapper's field.
+    pub field: Option<Field>,
+    pub start_byte: u32,
+    pub end_byte: u32,
+    pub parent: u32,
+    pub first_child: u32,
+    pub next_sibling: u32,
+}
+
+/// A lowered tree. Node 0 is the `source_file`.
+#[derive(Clone, Copy, Debug)]
+pub struct Ast<'a> {
+    nodes: &'a [AstNode],
+    names: &'a [&'a str],
+}
+
+impl<'a> Ast<'a> {
+    pub fn nodes(&self) -> &'a [AstNode] {
+        self.nodes
+    }
+
+    /// Every distinct identifier, indexed by [`Ident`].
+    pub fn names(&self) -> &'a [&'a str] {
+        self.names
+    }
+
+    pub fn name(&self, ident: Ident) -> &'a str {
+        self.names[ident.0 as usize]
+    }
+
+    /// Iterates over the children of node `i`.
+    pub fn children(&self, i: u32) -> impl Iterator<Item = u32> + 'a {
+        let nodes = self.nodes;
+        let first = Some(nodes[i as usize].first_child).filter(|&c| c != NO_NODE);
+        std::iter::successors(first, move |&c| {
+            Some(nodes[c as usize].next_sibling).filter(|&n| n != NO_NODE)
+        })
+    }
+
+    /// Returns the first child of node `i` that holds `field`.
+    pub fn child_by_field(&self, i: u32, field: Field) -> Option<u32> {
+        self.children(i)
+            .find(|&c| self.nodes[c as usize].field == Some(field))
+    }
+}
+
+/// Returns an arena large enough to hold `tree` lowered in one chunk.
+pub fn arena_for(tree: &Tree, source: &[u8]) -> Bump {
+    // Upper bounds: every node kept, and every byte of the source part of a
+    // distinct identifier.
+    let nodes = tree.root_node().descendant_count();
+    Bump::with_capacity(
+        nodes * std::mem::size_of::<AstNode>()
+            + source.len()
+            + (source.len() / 2) * std::mem::size_of::<&str>(),
+    )
+}
+
+#[derive(Clone, Copy)]
+struct Frame {
+    /// The AST node that children at this level attach to.
+    parent: u32,
+    last_child: u32,
+    /// Set for a skipped wrapper: the field its delegate child inherits.
+    inherited: Option<Option<Field>>,
+}
+
+/// Lowers trees, reusing its scratch buffers from one tree to the next.
+pub struct Lowerer {
+    identifier_id: u16,
+    nodes: Vec<AstNode>,
+    names: Vec<(usize, usize)>,
+    lookup: HashMap<Box<[u8]>, Ident>,
+    frames: Vec<Frame>,
+}
+
+impl Default for Lowerer {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Lowerer {
+    pub fn new() -> Self {
+        let language: tree_sitter::Language = crate::LANGUAGE.into();
+        Self {
+            // Identifiers are an anonymous alias, so NodeKind has no variant
+            // for them.
+            identifier_id: language.id_for_node_kind("identifier", false),
+            nodes: Vec::new(),
+            names: Vec::new(),
+            lookup: HashMap::new(),
+            frames: Vec::new(),
+        }
+    }
+
+    fn intern(&mut self, text: &[u8], start: usize) -> Ident {
+        if let Some(&ident) = self.lookup.get(text) {
+            return ident;
+        }
+        let ident = Ident(self.names.len() as u32);
+        self.names.push((start, start + text.len()));
+        self.lookup.insert(text.into(), ident);
+        ident
+    }
+
+    /// Lowers `tree`, which was parsed from `source`, into `arena` in a
+    /// single pre-order walk.
+    pub fn lower<'a>(&mut self, tree: &Tree, source: &[u8], arena: &'a Bump) -> Ast<'a> {
+        self.nodes.clear();
+        self.names.clear();
+        self.lookup.clear();
+        self.frames.clear();
+        self.frames.push(Frame {
+            parent: NO_NODE,
+            last_child: NO_NODE,
+            inherited: None,
+        });
+
+        let mut cursor = tree.walk();
+        loop {
+            let node = cursor.node();
+            let top = *self.frames.last().unwrap();
+            let mut field = cursor.field_id().and_then(|id| Field::from_id(id.get()));
+            if field == Some(Field::Delegate) {
+                field = top.inherited.flatten();
+            }
+
+            let kind = if node.kind_id() == self.identifier_id {
+                let (start, end) = (node.start_byte(), node.end_byte());
+                Some(AstKind::Identifier(self.intern(&source[start..end], start)))
+            } else if node.is_named() || node.is_error() {
+                NodeKind::from_id(node.kind_id()).map(AstKind::Node)
+            } else {
+                None
+            };
+            let wrapper = kind.is_some()
+                && node.child_count() == 1
+                && node.child_by_field_id(Field::Delegate as u16).is_some();
+
+            // The frame for this node's children, if it has any.
+            let mut frame = None;
+            if wrapper {
+                frame = Some(Frame {
+                    inherited: Some(field),
+                    ..top
+                });
+            } else if let Some(kind) = kind {
+                let index = self.nodes.len() as u32;
+                self.nodes.push(AstNode {
+                    kind,
+                    field,
+                    start_byte: node.start_byte() as u32,
+                    end_byte: node.end_byte() as u32,
+                    parent: top.parent,
+                    first_child: NO_NODE,
+                    next_sibling: NO_NODE,
+                });
+                self.link(index);
+                frame = Some(Frame {
+                    parent: index,
+                    last_child: NO_NODE,
+                    inherited: None,
+                });
+            }
+
+            if let Some(frame) = frame {
+                if cursor.goto_first_child() {
+                    self.frames.push(frame);
+                    continue;
+                }
+            }
+            while !cursor.goto_next_sibling() {
+                if !cursor.goto_parent() {
+                    return self.finish(source, arena);
+                }
+                // A wrapper's children were linked into its parent's list,
+                // so the parent's frame has to see where that list ended.
+                let done = self.frames.pop().unwrap();
+                let top = self.frames.last_mut().unwrap();
+                if done.inherited.is_some() {
+                    top.last_child = done.last_child;
+                }
+            }
+        }
+    }
+
+    /// Appends node `index` to the child list of the innermost frame.
+    fn link(&mut self, index: u32) {
+        let top = self.frames.last_mut().unwrap();
+        match top.last_child {
+            NO_NODE if top.parent != NO_NODE => self.nodes[top.parent as usize].first_child = index,
+            NO_NODE => {}
+            last => self.nodes[last as usize].next_sibling = index,
+        }
+        top.last_child = index;
+    }
+
+    fn finish<'a>(&mut self, source: &[u8], arena: &'a Bump) -> Ast<'a> {
+        let nodes = arena.alloc_slice_copy(&self.nodes);
+        let names =
+            arena.alloc_slice_fill_iter(self.names.iter().map(|&(start, end)| {
+                &*arena.alloc_str(&String::from_utf8_lossy(&source[start..end]))
+            }));
+        Ast { nodes, names }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn lower(source: &str, check: impl FnOnce(Ast)) {
+        let mut parser = tree_sitter::Parser::new();
+        parser.set_language(&crate::LANGUAGE.into()).unwrap();
+        let tree = parser.parse(source, None).unwrap();
+        let mut arena = arena_for(&tree, source.as_bytes());
+        check(Lowerer::new().lower(&tree, source.as_bytes(), &arena));
+        assert_eq!(arena.iter_allocated_chunks().count(), 1);
+    }
+
+    #[test]
+    fn test_delegates_are_skipped() {
+        lower("total = total + 1\n", |ast| {
+            let assign = ast.children(0).next().unwrap();
+            assert_eq!(
+                ast.nodes()[assign as usize].kind,
+                AstKind::Node(NodeKind::Assign)
+            );
+
+            // The right-hand side is the add_expr itself, not an expr chain.
+            let right = ast.child_by_field(assign, Field::Right).unwrap();
+            assert_eq!(
+                ast.nodes()[right as usize].kind,
+                AstKind::Node(NodeKind::AddExpr)
+            );
+            assert_eq!(ast.nodes()[right as usize].parent, assign);
+        });
+    }
+
+    #[test]
+    fn test_identifiers_are_interned() {
+        lower("a = b\nb = a\n", |ast| {
+            let idents: Vec<_> = ast
+                .nodes()
+                .iter()
+                .filter_map(|n| match n.kind {
+                    AstKind::Identifier(ident) => Some(ast.name(ident)),
+                    _ => None,
+                })
+                .collect();
+            assert_eq!(idents, ["a", "b", "b", "a"]);
+            assert_eq!(ast.names(), ["a", "b"]);
+        });
+    }
+}
@@ -0,0 +1,116 @@
+//! Lowering cost of `ast::Lowerer` against a Box-per-node AST.
+//!
+//! ```sh
+//! cargo bench --features ast --bench ast
+//! ```
+//!
+//! Before timing, prints the heap allocations one lowering of the 256 KiB
+//! script makes with each approach, counted by a wrapping global allocator.
+
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::path::Path;
+use std::sync::atomic::{AtomicUsize, Ordering};
+
+use criterion::{criterion_group, criterion_main, Criterion, Throughput};
+use tree_sitter::{Node, Parser, Tree};
+use tree_sitter_rad::ast::{self, Lowerer};
+
+struct Counting;
+
+static ALLOCATIONS: AtomicUsize = AtomicUsize::new(0);
+
+unsafe impl GlobalAlloc for Counting {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.alloc(layout)
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        System.dealloc(ptr, layout)
+    }
+}
+
+#[global_allocator]
+static GLOBAL: Counting = Counting;
+
+/// The conventional lowering: one Box per named node and one String per
+/// identifier.
+#[allow(dead_code)]
+enum BoxedAst {
+    Node {
+        kind: u16,
+        children: Vec<Box<BoxedAst>>,
+    },
+    Identifier(String),
+}
+
+fn lower_boxed(node: Node, source: &[u8], identifier_id: u16) -> Box<BoxedAst> {
+    if node.kind_id() == identifier_id {
+        let text = String::from_utf8_lossy(&source[node.byte_range()]).into_owned();
+        return Box::new(BoxedAst::Identifier(text));
+    }
+    let mut cursor = node.walk();
+    let children = node
+        .children(&mut cursor)
+        .filter(|child| child.is_named() || child.kind_id() == identifier_id)
+        .map(|child| lower_boxed(child, source, identifier_id))
+        .collect();
+    Box::new(BoxedAst::Node {
+        kind: node.kind_id(),
+        children,
+    })
+}
+
+fn allocations(f: impl FnOnce()) -> usize {
+    let before = ALLOCATIONS.load(Ordering::Relaxed);
+    f();
+    ALLOCATIONS.load(Ordering::Relaxed) - before
+}
+
+fn parse_script() -> (Vec<u8>, Tree) {
+    let unit =
+        std::fs::read(Path::new(env!("CARGO_MANIFEST_DIR")).join("bench/corpus/functions.rad"))
+            .unwrap();
+    let source = unit.repeat((256 << 10) / unit.len() + 1);
+    let mut parser = Parser::new();
+    parser
+        .set_language(&tree_sitter_rad::LANGUAGE.into())
+        .unwrap();
+    let tree = parser.parse(&source, None).unwrap();
+    (source, tree)
+}
+
+fn bench_lower(c: &mut Criterion) {
+    let (source, tree) = parse_script();
+    let language: tree_sitter::Language = tree_sitter_rad::LANGUAGE.into();
+    let identifier_id = language.id_for_node_kind("identifier", false);
+    let mut lowerer = Lowerer::new();
+
+    // Warm the lowerer's scratch buffers so the count reflects steady state.
+    lowerer.lower(&tree, &source, &ast::arena_for(&tree, &source));
+    let arena_allocs = allocations(|| {
+        let arena = ast::arena_for(&tree, &source);
+        lowerer.lower(&tree, &source, &arena);
+    });
+    let boxed_allocs = allocations(|| drop(lower_boxed(tree.root_node(), &source, identifier_id)));
+    eprintln!(
+        "allocations per lowering of {} nodes: arena {arena_allocs}, boxed {boxed_allocs}",
+        tree.root_node().descendant_count()
+    );
+
+    let mut group = c.benchmark_group("lower");
+    group.throughput(Throughput::Bytes(source.len() as u64));
+    group.bench_function("arena", |b| {
+        b.iter(|| {
+            let arena = ast::arena_for(&tree, &source);
+            lowerer.lower(&tree, &source, &arena).nodes().len()
+        })
+    });
+    group.bench_function("boxed", |b| {
+        b.iter(|| lower_boxed(tree.root_node(), &source, identifier_id))
+    });
+    group.finish();
+}
+
+criterion_group!(benches, bench_lower);
+criterion_main!(benches);
@@ -0,0 +1,63 @@
+//! Scaling of `parallel::parse_sources` from 1 to 64 threads.
+//!
+//! ```sh
+//! cargo bench --features parallel --bench parallel
+//! ```
+//!
+//! Every thread count is measured, including those above the machine's core
+//! count, where the points show what oversubscription costs. Throughput is
+//! per batch of the whole corpus repeated 64 times, or the scripts under
+//! RAD_BENCH_CORPUS.
+
+use std::path::{Path, PathBuf};
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use tree_sitter_rad::parallel;
+
+fn corpus_dir() -> PathBuf {
+    match std::env::var_os("RAD_BENCH_CORPUS") {
+        Some(dir) => dir.into(),
+        None => Path::new(env!("CARGO_MANIFEST_DIR")).join("bench/corpus"),
+    }
+}
+
+fn bench_scaling(c: &mut Criterion) {
+    let files = parallel::find_rad_files(&corpus_dir()).expect("reading corpus");
+    let sources: Vec<Vec<u8>> = files
+        .iter()
+        .map(|path| std::fs::read(path).unwrap())
+        .collect();
+    let sources: Vec<Vec<u8>> = sources
+        .iter()
+        .cycle()
+        .take(sources.len() * 64)
+        .cloned()
+        .collect();
+    let bytes: usize = sources.iter().map(Vec::len).sum();
+
+    let mut group = c.benchmark_group("parallel");
+    group.throughput(Throughput::Bytes(bytes as u64));
+    for threads in [1, 2, 4, 8, 16, 32, 64] {
+        let pool = rayon::ThreadPoolBuilder::new()
+            .num_threads(threads)
+            .build()
+            .unwrap();
+        group.bench_with_input(
+            BenchmarkId::new("threads", threads),
+            &sources,
+            |b, sources| {
+                b.iter(|| {
+                    pool.install(|| {
+                        parallel::parse_sources(sources, |_, _, tree| {
+                            tree.root_node().descendant_count()
+                        })
+                    })
+                })
+            },
+        );
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_scaling);
+criterion_main!(benches);
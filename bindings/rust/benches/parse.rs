@@ -0,0 +1,226 @@
+//! Criterion benchmarks for parsing, reparsing, traversal and queries.
+//!
+//! ```sh
+//! cargo bench --bench parse
+//! # profile one benchmark without criterion's analysis in the way:
+//! perf record --call-graph dwarf cargo bench --bench parse -- --profile-time 10 'parse/size/1MiB'
+//! ```
+//!
+//! The bench profile keeps debug info for both the Rust code and the C
+//! grammar, so perf and flamegraphs resolve frames inside `parser.c` and
+//! `scanner.c`.
+
+use std::path::{Path, PathBuf};
+
+use criterion::{criterion_group, criterion_main, BatchSize, BenchmarkId, Criterion, Throughput};
+use tree_sitter::{InputEdit, Parser, Point, Query, QueryCursor, StreamingIterator, Tree};
+
+fn corpus_dir() -> PathBuf {
+    match std::env::var_os("RAD_BENCH_CORPUS") {
+        Some(dir) => dir.into(),
+        None => Path::new(env!("CARGO_MANIFEST_DIR")).join("bench/corpus"),
+    }
+}
+
+/// Repeats bench/corpus/functions.rad, which has no preamble and so stays
+/// valid when concatenated, until it is at least `size` bytes long.
+fn sized_script(size: usize) -> Vec<u8> {
+    let unit =
+        std::fs::read(Path::new(env!("CARGO_MANIFEST_DIR")).join("bench/corpus/functions.rad"))
+            .expect("reading functions.rad");
+    unit.repeat(size.div_ceil(unit.len()))
+}
+
+fn new_parser() -> Parser {
+    let mut parser = Parser::new();
+    parser
+        .set_language(&tree_sitter_rad::LANGUAGE.into())
+        .expect("Error loading Rad parser");
+    parser
+}
+
+fn point_at(source: &[u8], offset: usize) -> Point {
+    let row = source[..offset].iter().filter(|&&b| b == b'\n').count();
+    let line_start = source[..offset]
+        .iter()
+        .rposition(|&b| b == b'\n')
+        .map_or(0, |i| i + 1);
+    Point::new(row, offset - line_start)
+}
+
+const SIZES: [(&str, usize); 4] = [
+    ("1KiB", 1 << 10),
+    ("16KiB", 16 << 10),
+    ("256KiB", 256 << 10),
+    ("1MiB", 1 << 20),
+];
+
+fn bench_parse(c: &mut Criterion) {
+    let mut parser = new_parser();
+    let mut group = c.benchmark_group("parse");
+    for (name, size) in SIZES {
+        let source = sized_script(size);
+        group.throughput(Throughput::Bytes(source.len() as u64));
+        group.bench_with_input(BenchmarkId::new("size", name), &source, |b, source| {
+            b.iter(|| parser.parse(source, None).unwrap())
+        });
+    }
+
+    let mut paths: Vec<_> = std::fs::read_dir(corpus_dir())
+        .expect("reading corpus")
+        .map(|entry| entry.unwrap().path())
+        .filter(|path| path.extension().is_some_and(|ext| ext == "rad"))
+        .collect();
+    paths.sort();
+    for path in paths {
+        let source = std::fs::read(&path).unwrap();
+        let name = path.file_name().unwrap().to_string_lossy().into_owned();
+        group.throughput(Throughput::Bytes(source.len() as u64));
+        group.bench_with_input(BenchmarkId::new("corpus", name), &source, |b, source| {
+            b.iter(|| parser.parse(source, None).unwrap())
+        });
+    }
+    group.finish();
+}
+
+/// Reads the reparse edits in bench/corpus/edits.tsv, shared with the other
+/// bindings' benchmarks, as (name, anchor, text) triples.
+fn read_edits() -> Vec<(String, String, String)> {
+    let path = Path::new(env!("CARGO_MANIFEST_DIR")).join("bench/corpus/edits.tsv");
+    let table = std::fs::read_to_string(path).expect("reading edits.tsv");
+    let unescape = |field: &str| {
+        let mut text = String::new();
+        let mut chars = field.chars();
+        while let Some(c) = chars.next() {
+            text.push(if c != '\\' {
+                c
+            } else {
+                match chars.next() {
+                    Some('n') => '\n',
+                    Some('t') => '\t',
+                    Some(other) => other,
+                    None => '\\',
+                }
+            });
+        }
+        text
+    };
+    table
+        .lines()
+        .filter(|line| !line.is_empty() && !line.starts_with('#'))
+        .map(|line| match line.split('\t').collect::<Vec<_>>()[..] {
+            [name, anchor, text] => (name.to_owned(), unescape(anchor), unescape(text)),
+            _ => panic!("edits.tsv: want NAME, ANCHOR and TEXT in {line:?}"),
+        })
+        .collect()
+}
+
+fn bench_reparse(c: &mut Criterion) {
+    let mut parser = new_parser();
+    let source = sized_script(256 << 10);
+    let tree = parser.parse(&source, None).unwrap();
+
+    let mut group = c.benchmark_group("reparse");
+    // Each edit inserts text just before the first match of its anchor past
+    // the middle of the script.
+    for (name, anchor, insert) in read_edits() {
+        let half = source.len() / 2;
+        let at = half
+            + source[half..]
+                .windows(anchor.len())
+                .position(|w| w == anchor.as_bytes())
+                .unwrap_or_else(|| panic!("anchor {anchor:?} not found"));
+        let new_source = [&source[..at], insert.as_bytes(), &source[at..]].concat();
+        let edit = InputEdit {
+            start_byte: at,
+            old_end_byte: at,
+            new_end_byte: at + insert.len(),
+            start_position: point_at(&source, at),
+            old_end_position: point_at(&source, at),
+            new_end_position: point_at(&new_source, at + insert.len()),
+        };
+
+        group.throughput(Throughput::Bytes(new_source.len() as u64));
+        group.bench_function(&name, |b| {
+            b.iter_batched(
+                || {
+                    let mut old = tree.clone();
+                    old.edit(&edit);
+                    old
+                },
+                |old| parser.parse(&new_source, Some(&old)).unwrap(),
+                BatchSize::SmallInput,
+            )
+        });
+    }
+    group.finish();
+}
+
+/// Visits every node with a cursor, reading its kind and byte range.
+fn walk(tree: &Tree) -> usize {
+    let mut cursor = tree.walk();
+    let mut sum = 0;
+    loop {
+        let node = cursor.node();
+        sum += node.kind_id() as usize + node.start_byte() + node.end_byte();
+        if cursor.goto_first_child() {
+            continue;
+        }
+        while !cursor.goto_next_sibling() {
+            if !cursor.goto_parent() {
+                return sum;
+            }
+        }
+    }
+}
+
+fn bench_traverse(c: &mut Criterion) {
+    let source = sized_script(256 << 10);
+    let tree = new_parser().parse(&source, None).unwrap();
+
+    let mut group = c.benchmark_group("traverse");
+    group.throughput(Throughput::Elements(
+        tree.root_node().descendant_count() as u64
+    ));
+    group.bench_function("cursor", |b| b.iter(|| walk(&tree)));
+    group.finish();
+}
+
+const QUERIES: [(&str, &str); 3] = [
+    ("calls", "(call func: _ @func)"),
+    ("fn_named", "(fn_named) @fn"),
+    ("interpolation", "(interpolation) @interp"),
+];
+
+fn bench_query(c: &mut Criterion) {
+    let source = sized_script(256 << 10);
+    let tree = new_parser().parse(&source, None).unwrap();
+    let language = tree_sitter_rad::LANGUAGE.into();
+
+    let mut group = c.benchmark_group("query");
+    group.throughput(Throughput::Bytes(source.len() as u64));
+    for (name, pattern) in QUERIES {
+        let query = Query::new(&language, pattern).expect("invalid query");
+        let mut cursor = QueryCursor::new();
+        group.bench_function(name, |b| {
+            b.iter(|| {
+                let mut matches = cursor.matches(&query, tree.root_node(), source.as_slice());
+                let mut count = 0;
+                while matches.next().is_some() {
+                    count += 1;
+                }
+                count
+            })
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_parse,
+    bench_reparse,
+    bench_traverse,
+    bench_query
+);
+criterion_main!(benches);
@@ -1,3 +1,7 @@
+use std::collections::HashMap;
+use std::fmt::Write;
+use std::path::Path;
+
 fn main() {
     let src_dir = std::path::Path::new("src");
 
@@ -17,4 +21,319 @@ fn main() {
     println!("cargo:rerun-if-changed={}", scanner_path.to_str().unwrap());
 
     c_config.compile("tree-sitter-rad");
+
+    let node_types_path = src_dir.join("node-types.json");
+    println!(
+        "cargo:rerun-if-changed={}",
+        node_types_path.to_str().unwrap()
+    );
+    let out_dir = std::env::var("OUT_DIR").unwrap();
+    generate_node_kinds(&parser_path, &node_types_path, Path::new(&out_dir));
+}
+
+/// Ids and names read from the tables in parser.c.
+struct ParserTables {
+    /// Symbol identifier to id, e.g. `sym_assign` to 160.
+    symbol_ids: HashMap<String, u16>,
+    symbol_names: HashMap<String, String>,
+    /// Maps each symbol to the public symbol that `ts_node_symbol` reports.
+    symbol_map: HashMap<String, String>,
+    named: HashMap<String, bool>,
+    field_ids: HashMap<String, u16>,
+}
+
+fn parse_tables(parser_c: &str) -> ParserTables {
+    // The generated tables put one `[ident] = value,` entry per line, apart
+    // from metadata, which spreads each entry over several lines.
+    fn section<'a>(src: &'a str, header: &str) -> &'a str {
+        let start = src
+            .find(header)
+            .unwrap_or_else(|| panic!("{header} not found in parser.c"));
+        let body = &src[start..];
+        &body[..body.find("\n};").unwrap()]
+    }
+    fn enum_ids(src: &str, name: &str) -> HashMap<String, u16> {
+        section(src, &format!("enum {name} {{"))
+            .lines()
+            .skip(1)
+            .filter_map(|line| {
+                let (ident, id) = line.trim().trim_end_matches(',').split_once(" = ")?;
+                Some((ident.to_string(), id.parse().ok()?))
+            })
+            .collect()
+    }
+    fn entries<'a>(src: &'a str, header: &str) -> impl Iterator<Item = (&'a str, &'a str)> {
+        section(src, header).lines().filter_map(|line| {
+            let (key, value) = line.trim().split_once("] = ")?;
+            Some((key.strip_prefix('[')?, value.trim_end_matches(',')))
+        })
+    }
+
+    let mut symbol_ids = enum_ids(parser_c, "ts_symbol_identifiers");
+    symbol_ids.insert("ts_builtin_sym_end".into(), 0);
+    let symbol_names = entries(parser_c, "static const char * const ts_symbol_names[]")
+        .map(|(ident, name)| (ident.to_string(), unescape(name)))
+        .collect();
+    let symbol_map = entries(parser_c, "static const TSSymbol ts_symbol_map[]")
+        .map(|(ident, public)| (ident.to_string(), public.to_string()))
+        .collect();
+
+    let mut named = HashMap::new();
+    let mut current = None;
+    for line in section(
+        parser_c,
+        "static const TSSymbolMetadata ts_symbol_metadata[]",
+    )
+    .lines()
+    {
+        let line = line.trim();
+        if let Some(ident) = line.strip_prefix('[').and_then(|l| l.strip_suffix("] = {")) {
+            current = Some(ident.to_string());
+        } else if let Some(value) = line.strip_prefix(".named = ") {
+            named.insert(current.take().unwrap(), value == "true,");
+        }
+    }
+
+    ParserTables {
+        symbol_ids,
+        symbol_names,
+        symbol_map,
+        named,
+        field_ids: enum_ids(parser_c, "ts_field_identifiers"),
+    }
+}
+
+fn unescape(literal: &str) -> String {
+    let inner = literal
+        .strip_prefix('"')
+        .and_then(|l| l.strip_suffix('"'))
+        .unwrap();
+    let mut out = String::new();
+    let mut chars = inner.chars();
+    while let Some(c) = chars.next() {
+        if c != '\\' {
+            out.push(c);
+            continue;
+        }
+        out.push(match chars.next() {
+            Some('n') => '\n',
+            Some('t') => '\t',
+            Some('r') => '\r',
+            Some('0') => '\0',
+            Some(other) => other,
+            None => '\\',
+        });
+    }
+    out
+}
+
+fn camel(name: &str) -> String {
+    name.split('_')
+        .filter(|part| !part.is_empty())
+        .map(|part| part[..1].to_uppercase() + &part[1..])
+        .collect()
+}
+
+fn method_name(field: &str) -> String {
+    match field {
+        "enum" | "type" | "match" | "mod" | "ref" | "loop" | "fn" | "in" | "as" | "use" => {
+            format!("r#{field}")
+        }
+        _ => field.to_string(),
+    }
+}
+
+/// Writes node_kinds.rs (the `NodeKind` and `Field` enums) and typed_nodes.rs
+/// (one wrapper per node kind with an accessor per field) to `out_dir`.
+///
+/// Kind ids are the public symbols from parser.c's `ts_symbol_map`, which is
+/// what `Node::kind_id` returns even for aliased nodes.
+fn generate_node_kinds(parser_path: &Path, node_types_path: &Path, out_dir: &Path) {
+    let tables = parse_tables(&std::fs::read_to_string(parser_path).unwrap());
+    let node_types: Vec<serde_json::Value> =
+        serde_json::from_str(&std::fs::read_to_string(node_types_path).unwrap()).unwrap();
+
+    let mut public_ids: HashMap<&str, u16> = HashMap::new();
+    for (ident, public) in &tables.symbol_map {
+        if tables.named[public.as_str()] && tables.named[ident.as_str()] {
+            let id = tables.symbol_ids[public.as_str()];
+            let name = tables.symbol_names[public.as_str()].as_str();
+            let entry = public_ids.entry(name).or_insert(id);
+            *entry = (*entry).min(id);
+        }
+    }
+
+    let mut kinds: Vec<(&str, u16)> = node_types
+        .iter()
+        .filter(|t| t["named"].as_bool().unwrap())
+        .map(|t| {
+            let name = t["type"].as_str().unwrap();
+            let id = *public_ids
+                .get(name)
+                .unwrap_or_else(|| panic!("node type {name} not found in parser.c"));
+            (name, id)
+        })
+        .collect();
+    kinds.sort_by_key(|&(_, id)| id);
+    let mut fields: Vec<(&str, u16)> = tables
+        .field_ids
+        .iter()
+        .map(|(ident, &id)| (ident.strip_prefix("field_").unwrap(), id))
+        .collect();
+    fields.sort_by_key(|&(_, id)| id);
+
+    let mut out = String::new();
+    writeln!(
+        out,
+        "/// A named node kind, as returned by `Node::kind_id`."
+    )
+    .unwrap();
+    writeln!(out, "#[repr(u16)]").unwrap();
+    writeln!(out, "#[derive(Clone, Copy, Debug, PartialEq, Eq, Hash)]").unwrap();
+    writeln!(out, "pub enum NodeKind {{").unwrap();
+    for &(name, id) in &kinds {
+        writeln!(out, "    /// `{name}`\n    {} = {id},", camel(name)).unwrap();
+    }
+    writeln!(out, "    /// `ERROR`\n    Error = 65535,\n}}\n").unwrap();
+    writeln!(out, "impl NodeKind {{").unwrap();
+    writeln!(
+        out,
+        "    /// Returns the kind with the given id, or `None` for anonymous nodes."
+    )
+    .unwrap();
+    writeln!(
+        out,
+        "    pub const fn from_id(id: u16) -> Option<Self> {{\n        match id {{"
+    )
+    .unwrap();
+    for &(name, id) in &kinds {
+        writeln!(out, "            {id} => Some(Self::{}),", camel(name)).unwrap();
+    }
+    writeln!(
+        out,
+        "            65535 => Some(Self::Error),\n            _ => None,\n        }}\n    }}\n"
+    )
+    .unwrap();
+    writeln!(out, "    /// The kind's name, as returned by `Node::kind`.").unwrap();
+    writeln!(
+        out,
+        "    pub const fn name(self) -> &'static str {{\n        match self {{"
+    )
+    .unwrap();
+    for &(name, _) in &kinds {
+        writeln!(out, "            Self::{} => {name:?},", camel(name)).unwrap();
+    }
+    writeln!(
+        out,
+        "            Self::Error => \"ERROR\",\n        }}\n    }}\n}}\n"
+    )
+    .unwrap();
+
+    writeln!(
+        out,
+        "/// A field id, as returned by `TreeCursor::field_id`."
+    )
+    .unwrap();
+    writeln!(out, "#[repr(u16)]").unwrap();
+    writeln!(out, "#[derive(Clone, Copy, Debug, PartialEq, Eq, Hash)]").unwrap();
+    writeln!(out, "pub enum Field {{").unwrap();
+    for &(name, id) in &fields {
+        writeln!(out, "    /// `{name}`\n    {} = {id},", camel(name)).unwrap();
+    }
+    writeln!(out, "}}\n\nimpl Field {{").unwrap();
+    writeln!(
+        out,
+        "    pub const fn from_id(id: u16) -> Option<Self> {{\n        match id {{"
+    )
+    .unwrap();
+    for &(name, id) in &fields {
+        writeln!(out, "            {id} => Some(Self::{}),", camel(name)).unwrap();
+    }
+    writeln!(out, "            _ => None,\n        }}\n    }}\n\n    pub const fn name(self) -> &'static str {{").unwrap();
+    writeln!(out, "        match self {{").unwrap();
+    for &(name, _) in &fields {
+        writeln!(out, "            Self::{} => {name:?},", camel(name)).unwrap();
+    }
+    writeln!(out, "        }}\n    }}\n}}").unwrap();
+    std::fs::write(out_dir.join("node_kinds.rs"), out).unwrap();
+
+    // A field whose only possible type is a single named kind returns that
+    // kind's wrapper; anything else returns a plain Node.
+    let wrapped: std::collections::HashSet<&str> = kinds.iter().map(|&(name, _)| name).collect();
+    let mut out = String::new();
+    for t in node_types.iter().filter(|t| t["named"].as_bool().unwrap()) {
+        let name = t["type"].as_str().unwrap();
+        let wrapper = format!("{}Node", camel(name));
+        writeln!(out, "/// A `{name}` node.").unwrap();
+        writeln!(out, "#[derive(Clone, Copy, Debug, PartialEq, Eq)]").unwrap();
+        writeln!(out, "pub struct {wrapper}<'tree>(Node<'tree>);\n").unwrap();
+        writeln!(out, "impl<'tree> {wrapper}<'tree> {{").unwrap();
+        writeln!(
+            out,
+            "    pub const KIND: NodeKind = NodeKind::{};\n",
+            camel(name)
+        )
+        .unwrap();
+        writeln!(out, "    pub fn cast(node: Node<'tree>) -> Option<Self> {{").unwrap();
+        writeln!(
+            out,
+            "        (node.kind_id() == Self::KIND as u16).then_some(Self(node))\n    }}\n"
+        )
+        .unwrap();
+        writeln!(
+            out,
+            "    pub fn node(self) -> Node<'tree> {{\n        self.0\n    }}"
+        )
+        .unwrap();
+
+        let mut field_names: Vec<_> = t["fields"]
+            .as_object()
+            .map(|f| f.iter().collect())
+            .unwrap_or_default();
+        field_names.sort_by_key(|(field, _)| field.as_str());
+        for (field, info) in field_names {
+            let types = info["types"].as_array().unwrap();
+            let target = match types.as_slice() {
+                [only]
+                    if only["named"].as_bool().unwrap()
+                        && wrapped.contains(only["type"].as_str().unwrap()) =>
+                {
+                    Some(format!("{}Node", camel(only["type"].as_str().unwrap())))
+                }
+                _ => None,
+            };
+            let (item, wrap) = match target {
+                Some(target) => (format!("{target}<'tree>"), format!(".map({target})")),
+                None => ("Node<'tree>".to_string(), String::new()),
+            };
+            let variant = camel(field);
+            writeln!(out).unwrap();
+            if info["multiple"].as_bool().unwrap() {
+                writeln!(out, "    /// Every child in the `{field}` field.").unwrap();
+                writeln!(out, "    pub fn {}<'cursor>(", method_name(field)).unwrap();
+                writeln!(
+                    out,
+                    "        self,\n        cursor: &'cursor mut TreeCursor<'tree>,"
+                )
+                .unwrap();
+                writeln!(out, "    ) -> impl Iterator<Item = {item}> + 'cursor {{").unwrap();
+                writeln!(out, "        self.0.children_by_field_id(field_id(Field::{variant}), cursor){wrap}\n    }}").unwrap();
+            } else {
+                writeln!(out, "    /// The child in the `{field}` field.").unwrap();
+                writeln!(
+                    out,
+                    "    pub fn {}(self) -> Option<{item}> {{",
+                    method_name(field)
+                )
+                .unwrap();
+                writeln!(
+                    out,
+                    "        self.0.child_by_field_id(Field::{variant} as u16){wrap}\n    }}"
+                )
+                .unwrap();
+            }
+        }
+        writeln!(out, "}}\n").unwrap();
+    }
+    std::fs::write(out_dir.join("typed_nodes.rs"), out).unwrap();
 }
@@ -0,0 +1,465 @@
+//! Reading and writing the CST file format, enabled by the `cst` feature.
+//!
+//! A CST file holds every node of a tree as a fixed-size record, plus
+//! optionally the source; `CST.md` in the repository specifies it. Files are
+//! interchangeable with the C library's `tree_sitter_rad_cst_write` and the
+//! Go binding's `WriteCST`.
+//!
+//! ```
+//! use tree_sitter_rad::cst;
+//!
+//! let mut parser = tree_sitter::Parser::new();
+//! parser.set_language(&tree_sitter_rad::LANGUAGE.into()).unwrap();
+//! let source = "total = total + 1\n";
+//! let tree = parser.parse(source, None).unwrap();
+//!
+//! let data = cst::write(&tree, source.as_bytes(), true);
+//! let cst = cst::Cst::open(&data).unwrap();
+//! assert_eq!(cst.source(), Some(source.as_bytes()));
+//! assert_eq!(cst.nodes()[0].end_byte as usize, source.len());
+//! ```
+
+use std::borrow::Cow;
+use std::fmt;
+
+use tree_sitter::{Language, Node as TsNode, Tree};
+
+/// The format version that [`write`] writes and [`Cst::open`] reads.
+pub const VERSION: u16 = 1;
+
+/// Marks a missing parent, first child or next sibling.
+pub const NO_NODE: u32 = u32::MAX;
+
+/// Header flag: the source follows the records.
+pub const EMBEDDED_SOURCE: u16 = 1 << 0;
+
+/// Node flags.
+pub const NAMED: u16 = 1 << 0;
+pub const EXTRA: u16 = 1 << 1;
+pub const MISSING: u16 = 1 << 2;
+pub const ERROR: u16 = 1 << 3;
+pub const HAS_ERROR: u16 = 1 << 4;
+
+const HEADER_SIZE: usize = 64;
+const NODE_SIZE: usize = 44;
+
+/// Describes a serialized tree and the grammar and source it came from.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct Header {
+    pub version: u16,
+    pub flags: u16,
+    pub language_version: u32,
+    pub symbol_count: u32,
+    pub field_count: u32,
+    pub state_count: u32,
+    pub grammar_hash: u64,
+    pub source_hash: u64,
+    pub source_length: u32,
+    pub node_count: u32,
+}
+
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct Point {
+    pub row: u32,
+    pub column: u32,
+}
+
+/// One record of a serialized tree. Indices refer to positions in
+/// [`Cst::nodes`], which are in pre-order.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct Node {
+    pub kind_id: u16,
+    /// The field the node holds in its parent, or 0.
+    pub field_id: u16,
+    pub start_byte: u32,
+    pub end_byte: u32,
+    pub parent: u32,
+    pub first_child: u32,
+    pub next_sibling: u32,
+    pub start_point: Point,
+    pub end_point: Point,
+    pub flags: u16,
+    reserved: u16,
+}
+
+const _: () = assert!(std::mem::size_of::<Node>() == NODE_SIZE);
+
+/// The error [`Cst::open`] returns for data that isn't a complete CST file of
+/// a version and flags this crate reads, or whose records link outside the
+/// records or out of pre-order or have byte ranges past the source.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct InvalidCst;
+
+impl fmt::Display for InvalidCst {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.write_str("invalid CST")
+    }
+}
+
+impl std::error::Error for InvalidCst {}
+
+/// A serialized tree, read from a byte slice.
+#[derive(Clone, Debug)]
+pub struct Cst<'a> {
+    header: Header,
+    nodes: Cow<'a, [Node]>,
+    source: Option<&'a [u8]>,
+}
+
+fn u16_at(data: &[u8], at: usize) -> u16 {
+    u16::from_le_bytes(data[at..at + 2].try_into().unwrap())
+}
+
+fn u32_at(data: &[u8], at: usize) -> u32 {
+    u32::from_le_bytes(data[at..at + 4].try_into().unwrap())
+}
+
+fn u64_at(data: &[u8], at: usize) -> u64 {
+    u64::from_le_bytes(data[at..at + 8].try_into().unwrap())
+}
+
+fn decode_node(b: &[u8]) -> Node {
+    Node {
+        kind_id: u16_at(b, 0),
+        field_id: u16_at(b, 2),
+        start_byte: u32_at(b, 4),
+        end_byte: u32_at(b, 8),
+        parent: u32_at(b, 12),
+        first_child: u32_at(b, 16),
+        next_sibling: u32_at(b, 20),
+        start_point: Point {
+            row: u32_at(b, 24),
+            column: u32_at(b, 28),
+        },
+        end_point: Point {
+            row: u32_at(b, 32),
+            column: u32_at(b, 36),
+        },
+        flags: u16_at(b, 40),
+        reserved: 0,
+    }
+}
+
+/// Checks that every link stays inside `nodes` and follows pre-order, so no
+/// walk goes out of bounds or around in a cycle, and that every byte range is
+/// within the source.
+fn valid_nodes(nodes: &[Node], source_length: u32) -> bool {
+    let count = nodes.len() as u32;
+    nodes.iter().zip(0u32..).all(|(node, i)| {
+        let parent_valid = if i == 0 {
+            node.parent == NO_NODE
+        } else {
+            node.parent < i
+        };
+        let child_valid =
+            node.first_child == NO_NODE || (node.first_child == i + 1 && i + 1 < count);
+        let sibling_valid =
+            node.next_sibling == NO_NODE || (node.next_sibling > i && node.next_sibling < count);
+        parent_valid
+            && child_valid
+            && sibling_valid
+            && node.start_byte <= node.end_byte
+            && node.end_byte <= source_length
+    })
+}
+
+impl<'a> Cst<'a> {
+    /// Reads a serialized tree, checking every record so that files from
+    /// elsewhere can be walked safely. The records are used in place when
+    /// they are 4-byte aligned on a little-endian host, and decoded
+    /// otherwise.
+    pub fn open(data: &'a [u8]) -> Result<Self, InvalidCst> {
+        if data.len() < HEADER_SIZE || &data[..4] != b"RCST" {
+            return Err(InvalidCst);
+        }
+        let header = Header {
+            version: u16_at(data, 4),
+            flags: u16_at(data, 6),
+            language_version: u32_at(data, 8),
+            symbol_count: u32_at(data, 12),
+            field_count: u32_at(data, 16),
+            state_count: u32_at(data, 20),
+            grammar_hash: u64_at(data, 24),
+            source_hash: u64_at(data, 32),
+            source_length: u32_at(data, 40),
+            node_count: u32_at(data, 44),
+        };
+        if header.version != VERSION
+            || header.flags & !EMBEDDED_SOURCE != 0
+            || u32_at(data, 48) as usize != NODE_SIZE
+        {
+            return Err(InvalidCst);
+        }
+        let end = HEADER_SIZE as u64 + header.node_count as u64 * NODE_SIZE as u64;
+        let embedded = header.flags & EMBEDDED_SOURCE != 0;
+        let source_end = end
+            + if embedded {
+                header.source_length as u64
+            } else {
+                0
+            };
+        if (data.len() as u64) < source_end {
+            return Err(InvalidCst);
+        }
+        let (end, source_end) = (end as usize, source_end as usize);
+
+        let records = &data[HEADER_SIZE..end];
+        // SAFETY: Node is plain old data with no padding, so any bytes are a
+        // valid Node.
+        let (prefix, nodes, _) = unsafe { records.align_to::<Node>() };
+        let nodes = if cfg!(target_endian = "little") && prefix.is_empty() {
+            Cow::Borrowed(nodes)
+        } else {
+            Cow::Owned(records.chunks_exact(NODE_SIZE).map(decode_node).collect())
+        };
+        if !valid_nodes(&nodes, header.source_length) {
+            return Err(InvalidCst);
+        }
+        Ok(Cst {
+            header,
+            nodes,
+            source: embedded.then(|| &data[end..source_end]),
+        })
+    }
+
+    pub fn header(&self) -> &Header {
+        &self.header
+    }
+
+    pub fn nodes(&self) -> &[Node] {
+        &self.nodes
+    }
+
+    /// The embedded source, if the tree was written with it.
+    pub fn source(&self) -> Option<&'a [u8]> {
+        self.source
+    }
+
+    /// Whether the tree was written for `language`, so that its kind and
+    /// field ids can be used with it.
+    pub fn matches_language(&self, language: &Language) -> bool {
+        let h = &self.header;
+        h.language_version as usize == language.version()
+            && h.symbol_count as usize == language.node_kind_count()
+            && h.field_count as usize == language.field_count()
+            && h.state_count as usize == language.parse_state_count()
+            && h.grammar_hash == grammar_hash(language)
+    }
+}
+
+const FNV_OFFSET: u64 = 0xcbf29ce484222325;
+const FNV_PRIME: u64 = 0x100000001b3;
+
+fn fnv1a(hash: u64, data: &[u8]) -> u64 {
+    data.iter()
+        .fold(hash, |hash, &b| (hash ^ b as u64).wrapping_mul(FNV_PRIME))
+}
+
+/// Hashes a source the way CST headers do.
+pub fn source_hash(source: &[u8]) -> u64 {
+    fnv1a(FNV_OFFSET, source)
+}
+
+/// Hashes the symbol and field names of `language` along with its table
+/// sizes, matching `tree_sitter_rad_grammar_hash`.
+pub fn grammar_hash(language: &Language) -> u64 {
+    let counts = [
+        language.version(),
+        language.node_kind_count(),
+        language.field_count(),
+        language.parse_state_count(),
+    ];
+    let mut hash = FNV_OFFSET;
+    for count in counts {
+        hash = fnv1a(hash, &(count as u32).to_le_bytes());
+    }
+    for id in 0..language.node_kind_count() {
+        let name = language.node_kind_for_id(id as u16).unwrap_or("");
+        hash = fnv1a(fnv1a(hash, name.as_bytes()), &[0]);
+    }
+    for id in 1..=language.field_count() {
+        let name = language.field_name_for_id(id as u16).unwrap_or("");
+        hash = fnv1a(fnv1a(hash, name.as_bytes()), &[0]);
+    }
+    hash
+}
+
+fn record(node: TsNode, field_id: u16, parent: u32) -> Node {
+    let mut flags = 0;
+    for (set, flag) in [
+        (node.is_named(), NAMED),
+        (node.is_extra(), EXTRA),
+        (node.is_missing(), MISSING),
+        (node.is_error(), ERROR),
+        (node.has_error(), HAS_ERROR),
+    ] {
+        if set {
+            flags |= flag;
+        }
+    }
+    let (start, end) = (node.start_position(), node.end_position());
+    Node {
+        kind_id: node.kind_id(),
+        field_id,
+        start_byte: node.start_byte() as u32,
+        end_byte: node.end_byte() as u32,
+        parent,
+        first_child: NO_NODE,
+        next_sibling: NO_NODE,
+        start_point: Point {
+            row: start.row as u32,
+            column: start.column as u32,
+        },
+        end_point: Point {
+            row: end.row as u32,
+            column: end.column as u32,
+        },
+        flags,
+        reserved: 0,
+    }
+}
+
+/// Serializes `tree`, parsed from `source`, with a copy of the source if
+/// `embed_source` is set.
+pub fn write(tree: &Tree, source: &[u8], embed_source: bool) -> Vec<u8> {
+    // The same walk as the C writer: records carry their parent index, so
+    // `current` follows the cursor back up without a stack.
+    let root = tree.root_node();
+    let mut nodes = Vec::with_capacity(root.descendant_count());
+    let mut cursor = root.walk();
+    nodes.push(record(root, 0, NO_NODE));
+    let mut current = 0usize;
+    'walk: loop {
+        if cursor.goto_first_child() {
+            let field = cursor.field_id().map_or(0, |id| id.get());
+            nodes.push(record(cursor.node(), field, current as u32));
+            nodes[current].first_child = (nodes.len() - 1) as u32;
+            current = nodes.len() - 1;
+            continue;
+        }
+        loop {
+            if cursor.goto_next_sibling() {
+                let field = cursor.field_id().map_or(0, |id| id.get());
+                nodes.push(record(cursor.node(), field, nodes[current].parent));
+                nodes[current].next_sibling = (nodes.len() - 1) as u32;
+                current = nodes.len() - 1;
+                break;
+            }
+            if current == 0 || !cursor.goto_parent() {
+                break 'walk;
+            }
+            current = nodes[current].parent as usize;
+        }
+    }
+
+    let language = tree.language();
+    let source_length = if embed_source { source.len() } else { 0 };
+    let mut data = Vec::with_capacity(HEADER_SIZE + nodes.len() * NODE_SIZE + source_length);
+    data.extend_from_slice(b"RCST");
+    data.extend_from_slice(&VERSION.to_le_bytes());
+    data.extend_from_slice(&(if embed_source { EMBEDDED_SOURCE } else { 0 }).to_le_bytes());
+    for value in [
+        language.version(),
+        language.node_kind_count(),
+        language.field_count(),
+        language.parse_state_count(),
+    ] {
+        data.extend_from_slice(&(value as u32).to_le_bytes());
+    }
+    data.extend_from_slice(&grammar_hash(&language).to_le_bytes());
+    data.extend_from_slice(&source_hash(source).to_le_bytes());
+    for value in [source.len(), nodes.len(), NODE_SIZE, 0, 0, 0] {
+        data.extend_from_slice(&(value as u32).to_le_bytes());
+    }
+    for node in &nodes {
+        for value in [node.kind_id, node.field_id] {
+            data.extend_from_slice(&value.to_le_bytes());
+        }
+        for value in [
+            node.start_byte,
+            node.end_byte,
+            node.parent,
+            node.first_child,
+            node.next_sibling,
+            node.start_point.row,
+            node.start_point.column,
+            node.end_point.row,
+            node.end_point.column,
+        ] {
+            data.extend_from_slice(&value.to_le_bytes());
+        }
+        data.extend_from_slice(&node.flags.to_le_bytes());
+        data.extend_from_slice(&0u16.to_le_bytes());
+    }
+    if embed_source {
+        data.extend_from_slice(source);
+    }
+    data
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn parse(source: &str) -> Tree {
+        let mut parser = tree_sitter::Parser::new();
+        parser.set_language(&crate::LANGUAGE.into()).unwrap();
+        parser.parse(source, None).unwrap()
+    }
+
+    #[test]
+    fn test_round_trip_matches_tree() {
+        let source = "fn add(a, b):\n    return a + b\nprint(add(1, 2))\n";
+        let tree = parse(source);
+        let data = write(&tree, source.as_bytes(), false);
+        let cst = Cst::open(&data).unwrap();
+        assert_eq!(cst.source(), None);
+        assert!(cst.matches_language(&crate::LANGUAGE.into()));
+        assert_eq!(cst.nodes().len(), tree.root_node().descendant_count());
+
+        // Records are in pre-order, so they line up with a descendant walk.
+        let mut cursor = tree.walk();
+        for (i, node) in cst.nodes().iter().enumerate() {
+            cursor.goto_descendant(i);
+            let expected = cursor.node();
+            assert_eq!(node.kind_id, expected.kind_id());
+            assert_eq!(node.start_byte as usize, expected.start_byte());
+            assert_eq!(node.end_point.row as usize, expected.end_position().row);
+        }
+    }
+
+    #[test]
+    fn test_unaligned_and_truncated_data() {
+        let source = "a = [1, 2]\n";
+        let data = write(&parse(source), source.as_bytes(), true);
+        let aligned = Cst::open(&data).unwrap();
+
+        let mut shifted = vec![0u8; data.len() + 1];
+        shifted[1..].copy_from_slice(&data);
+        let decoded = Cst::open(&shifted[1..]).unwrap();
+        assert_eq!(decoded.nodes(), aligned.nodes());
+        assert_eq!(decoded.source(), Some(source.as_bytes()));
+
+        assert_eq!(Cst::open(&data[..data.len() - 1]).unwrap_err(), InvalidCst);
+    }
+
+    #[test]
+    fn test_rejects_bad_links_and_ranges() {
+        let source = "a = [1, 2]\n";
+        let data = write(&parse(source), source.as_bytes(), false);
+        let count = Cst::open(&data).unwrap().nodes().len() as u32;
+        // Offsets within record 1; see CST.md.
+        for (offset, value) in [(12, 5), (16, count), (20, 0), (8, source.len() as u32 + 1)] {
+            let mut corrupt = data.clone();
+            let at = HEADER_SIZE + NODE_SIZE + offset;
+            corrupt[at..at + 4].copy_from_slice(&value.to_le_bytes());
+            assert_eq!(
+                Cst::open(&corrupt).unwrap_err(),
+                InvalidCst,
+                "offset {offset}"
+            );
+        }
+    }
+}
@@ -0,0 +1,7 @@
+//! Node kind and field ids as enums, generated by `build.rs` from
+//! `src/node-types.json` and the symbol tables in `src/parser.c`.
+//!
+//! Dispatching on `NodeKind::from_id(node.kind_id())` is a plain integer
+//! match, with no string comparison or JSON parsing at runtime.
+
+include!(concat!(env!("OUT_DIR"), "/node_kinds.rs"));
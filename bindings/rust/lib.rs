@@ -34,6 +34,16 @@ pub const LANGUAGE: LanguageFn = unsafe { LanguageFn::from_raw(tree_sitter_rad)
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
 pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
 
+#[cfg(feature = "ast")]
+pub mod ast;
+#[cfg(feature = "cst")]
+pub mod cst;
+pub mod kinds;
+#[cfg(feature = "parallel")]
+pub mod parallel;
+#[cfg(feature = "typed")]
+pub mod typed;
+
 // NOTE: uncomment these to include any queries that this grammar contains:
 
 // pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
@@ -50,4 +60,31 @@ mod tests {
             .set_language(&super::LANGUAGE.into())
             .expect("Error loading Rad parser");
     }
+
+    #[test]
+    fn test_kind_ids_match_language() {
+        use super::kinds::{Field, NodeKind};
+
+        let language: tree_sitter::Language = super::LANGUAGE.into();
+        for kind in [
+            NodeKind::SourceFile,
+            NodeKind::Assign,
+            NodeKind::Call,
+            NodeKind::FnNamed,
+            NodeKind::String,
+        ] {
+            assert_eq!(
+                language.id_for_node_kind(kind.name(), true),
+                kind as u16,
+                "{kind:?}"
+            );
+            assert_eq!(NodeKind::from_id(kind as u16), Some(kind));
+        }
+        for field in [Field::Func, Field::Left, Field::Right, Field::Type] {
+            assert_eq!(
+                language.field_id_for_name(field.name()).map(|id| id.get()),
+                Some(field as u16)
+            );
+        }
+    }
 }
@@ -0,0 +1,186 @@
+//! Parallel parsing of many Rad files, enabled by the `parallel` feature.
+//!
+//! Work is spread over the current [rayon][] pool, so callers control the
+//! thread count with `ThreadPool::install`. Each worker thread keeps one
+//! parser for its lifetime, and inputs are handed out largest first so a big
+//! file picked up last can't leave the other threads idle at the end.
+//!
+//! ```no_run
+//! use tree_sitter_rad::parallel;
+//!
+//! let paths = parallel::find_rad_files(std::path::Path::new("scripts")).unwrap();
+//! let has_error = parallel::parse_files(&paths, |_, _, tree| tree.root_node().has_error());
+//! ```
+//!
+//! [rayon]: https://docs.rs/rayon
+
+use std::cell::RefCell;
+use std::io;
+use std::path::{Path, PathBuf};
+
+use rayon::prelude::*;
+use tree_sitter::{Parser, Tree};
+
+thread_local! {
+    static PARSER: RefCell<Parser> = RefCell::new({
+        let mut parser = Parser::new();
+        parser
+            .set_language(&crate::LANGUAGE.into())
+            .expect("Error loading Rad parser");
+        parser
+    });
+}
+
+/// Parses `source` with the calling thread's parser.
+pub fn parse(source: &[u8]) -> Tree {
+    // The borrow ends before the tree is handed to any callback, so a
+    // callback may parse again on the same thread.
+    PARSER
+        .with(|parser| parser.borrow_mut().parse(source, None))
+        .expect("parsing without a timeout or cancellation flag can't fail")
+}
+
+/// Returns the input indices ordered by decreasing size.
+fn largest_first(sizes: impl Iterator<Item = u64>) -> Vec<usize> {
+    let mut order: Vec<(u64, usize)> = sizes.enumerate().map(|(i, size)| (size, i)).collect();
+    order.sort_unstable_by(|a, b| b.cmp(a));
+    order.into_iter().map(|(_, i)| i).collect()
+}
+
+/// Puts results computed in `order` back into input order.
+fn unpermute<T>(order: &[usize], results: Vec<T>) -> Vec<T> {
+    let mut slots: Vec<Option<T>> = std::iter::repeat_with(|| None).take(order.len()).collect();
+    for (&i, result) in order.iter().zip(results) {
+        slots[i] = Some(result);
+    }
+    slots.into_iter().map(|slot| slot.unwrap()).collect()
+}
+
+/// Parses every source in parallel and returns `f(index, source, tree)` for
+/// each, in input order.
+pub fn parse_sources<S, T, F>(sources: &[S], f: F) -> Vec<T>
+where
+    S: AsRef<[u8]> + Sync,
+    T: Send,
+    F: Fn(usize, &[u8], Tree) -> T + Sync,
+{
+    let order = largest_first(sources.iter().map(|s| s.as_ref().len() as u64));
+    let results = order
+        .par_iter()
+        .with_max_len(1)
+        .map(|&i| {
+            let source = sources[i].as_ref();
+            f(i, source, parse(source))
+        })
+        .collect();
+    unpermute(&order, results)
+}
+
+/// Reads and parses every file in parallel and returns `f(path, source, tree)`
+/// for each, in input order. A file that can't be read yields its error.
+pub fn parse_files<P, T, F>(paths: &[P], f: F) -> Vec<io::Result<T>>
+where
+    P: AsRef<Path> + Sync,
+    T: Send,
+    F: Fn(&Path, &[u8], Tree) -> T + Sync,
+{
+    // Sizes come from metadata so files aren't held in memory before their
+    // turn; an unreadable file sorts last and fails when read.
+    let sizes = paths
+        .par_iter()
+        .map(|path| std::fs::metadata(path).map_or(0, |m| m.len()))
+        .collect::<Vec<_>>();
+    let order = largest_first(sizes.into_iter());
+    let results: Vec<_> = order
+        .par_iter()
+        .with_max_len(1)
+        .map(|&i| {
+            let path = paths[i].as_ref();
+            let source = std::fs::read(path)?;
+            let tree = parse(&source);
+            Ok(f(path, &source, tree))
+        })
+        .collect();
+    unpermute(&order, results)
+}
+
+/// Totals over a set of parsed files.
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct ParseStats {
+    pub files: usize,
+    pub bytes: u64,
+    pub nodes: u64,
+    /// Files whose tree contains an ERROR or MISSING node.
+    pub files_with_errors: usize,
+}
+
+impl ParseStats {
+    fn of(source: &[u8], tree: &Tree) -> Self {
+        let root = tree.root_node();
+        Self {
+            files: 1,
+            bytes: source.len() as u64,
+            nodes: root.descendant_count() as u64,
+            files_with_errors: root.has_error() as usize,
+        }
+    }
+
+    fn merge(self, other: Self) -> Self {
+        Self {
+            files: self.files + other.files,
+            bytes: self.bytes + other.bytes,
+            nodes: self.nodes + other.nodes,
+            files_with_errors: self.files_with_errors + other.files_with_errors,
+        }
+    }
+}
+
+/// Parses every file and sums their [`ParseStats`], failing on the first file
+/// that can't be read.
+pub fn parse_stats<P: AsRef<Path> + Sync>(paths: &[P]) -> io::Result<ParseStats> {
+    parse_files(paths, |_, source, tree| ParseStats::of(source, &tree))
+        .into_par_iter()
+        .try_reduce(ParseStats::default, |a, b| Ok(a.merge(b)))
+}
+
+/// Lists the `.rad` files under `root`, recursively and in sorted order.
+pub fn find_rad_files(root: &Path) -> io::Result<Vec<PathBuf>> {
+    let mut files = Vec::new();
+    let mut dirs = vec![root.to_path_buf()];
+    while let Some(dir) = dirs.pop() {
+        for entry in std::fs::read_dir(&dir)? {
+            let entry = entry?;
+            let path = entry.path();
+            if entry.file_type()?.is_dir() {
+                dirs.push(path);
+            } else if path.extension().is_some_and(|ext| ext == "rad") {
+                files.push(path);
+            }
+        }
+    }
+    files.sort();
+    Ok(files)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_results_keep_input_order() {
+        let sources = ["a = 1\n", "fn f(x):\n    return x\n", "", "print(1)\n"];
+        let lengths = parse_sources(&sources, |i, source, tree| {
+            assert_eq!(source, sources[i].as_bytes());
+            tree.root_node().end_byte()
+        });
+        assert_eq!(lengths, sources.iter().map(|s| s.len()).collect::<Vec<_>>());
+    }
+
+    #[test]
+    fn test_corpus_parses_cleanly() {
+        let corpus = Path::new(env!("CARGO_MANIFEST_DIR")).join("bench/corpus");
+        let stats = parse_stats(&find_rad_files(&corpus).unwrap()).unwrap();
+        assert!(stats.files > 0);
+        assert_eq!(stats.files_with_errors, 0);
+    }
+}
@@ -0,0 +1,27 @@
+//! Typed wrappers for each named node kind, enabled by the `typed` feature
+//! and generated by `build.rs` from `src/node-types.json`.
+//!
+//! Each wrapper has one accessor per field; a field whose only possible type
+//! is another named kind returns that kind's wrapper:
+//!
+//! ```
+//! use tree_sitter_rad::typed::AssignNode;
+//!
+//! let mut parser = tree_sitter::Parser::new();
+//! parser.set_language(&tree_sitter_rad::LANGUAGE.into()).unwrap();
+//! let tree = parser.parse("a = 1\n", None).unwrap();
+//! let stmt = tree.root_node().named_child(0).unwrap();
+//! let assign = AssignNode::cast(stmt).unwrap();
+//! let mut cursor = tree.walk();
+//! assert_eq!(assign.right(&mut cursor).count(), 1);
+//! ```
+
+use tree_sitter::{Node, TreeCursor};
+
+use crate::kinds::{Field, NodeKind};
+
+fn field_id(field: Field) -> tree_sitter::FieldId {
+    tree_sitter::FieldId::new(field as u16).unwrap()
+}
+
+include!(concat!(env!("OUT_DIR"), "/typed_nodes.rs"));
@@ -0,0 +1,95 @@
+import Foundation
+import SwiftTreeSitter
+import TreeSitterRad
+
+/// Parses many Rad documents concurrently.
+///
+/// Each worker task owns one `Parser` for the whole batch and claims
+/// documents from a shared queue until none are left, so a few large
+/// documents don't leave the other workers idle.
+@available(macOS 10.15, iOS 13, tvOS 13, watchOS 6, *)
+public enum RadBatchParser {
+    /// Parses every source and returns `transform(index, tree)` for each, in
+    /// input order, or nil where parsing failed.
+    ///
+    /// Trees are not `Sendable`, so anything derived from them is computed
+    /// inside the worker by `transform`.
+    public static func parse<T: Sendable>(
+        _ sources: [String],
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount,
+        transform: @escaping @Sendable (Int, MutableTree) throws -> T
+    ) async throws -> [T?] {
+        let queue = WorkQueue(count: sources.count)
+        let workers = max(1, min(maxConcurrency, sources.count))
+        let language = Language(language: tree_sitter_rad())
+
+        return try await withThrowingTaskGroup(of: [(Int, T?)].self) { group in
+            for _ in 0..<workers {
+                group.addTask {
+                    let parser = Parser()
+                    try parser.setLanguage(language)
+                    var results: [(Int, T?)] = []
+                    while let index = await queue.claim() {
+                        try Task.checkCancellation()
+                        results.append((index, try parser.parse(sources[index]).map { try transform(index, $0) }))
+                    }
+                    return results
+                }
+            }
+
+            var ordered = [T?](repeating: nil, count: sources.count)
+            for try await results in group {
+                for (index, result) in results {
+                    ordered[index] = result
+                }
+            }
+            return ordered
+        }
+    }
+
+    /// Parses every source and returns the number of nodes in each tree, or
+    /// nil where parsing failed.
+    public static func nodeCounts(
+        _ sources: [String],
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) async throws -> [Int?] {
+        try await parse(sources, maxConcurrency: maxConcurrency) { _, tree in
+            tree.rootNode.map(countNodes) ?? 0
+        }
+    }
+
+    /// Counts the nodes under and including `node` with a tree cursor.
+    public static func countNodes(_ node: Node) -> Int {
+        let cursor = node.treeCursor
+        var count = 0
+        while true {
+            count += 1
+            if cursor.goToFirstChild() {
+                continue
+            }
+            // The cursor can't leave the subtree it started on.
+            while !cursor.goToNextSibling() {
+                if !cursor.goToParent() {
+                    return count
+                }
+            }
+        }
+    }
+}
+
+/// Hands out the indices 0..<count, each once.
+@available(macOS 10.15, iOS 13, tvOS 13, watchOS 6, *)
+private actor WorkQueue {
+    private var next = 0
+    private let count: Int
+
+    init(count: Int) {
+        self.count = count
+    }
+
+    func claim() -> Int? {
+        guard next < count else { return nil }
+        defer { next += 1 }
+        return next
+    }
+}
@@ -0,0 +1,77 @@
+import XCTest
+import SwiftTreeSitter
+import TreeSitterRad
+import TreeSitterRadBatch
+
+/// Parse and traversal timings on bench/corpus, run with `swift test`.
+final class TreeSitterRadPerformanceTests: XCTestCase {
+    private static let repoRoot = URL(fileURLWithPath: #filePath)
+        .deletingLastPathComponent()
+        .deletingLastPathComponent()
+        .deletingLastPathComponent()
+        .deletingLastPathComponent()
+
+    private func corpus() throws -> [String] {
+        let dir = Self.repoRoot.appendingPathComponent("bench/corpus")
+        return try FileManager.default.contentsOfDirectory(at: dir, includingPropertiesForKeys: nil)
+            .filter { $0.pathExtension == "rad" }
+            .sorted { $0.path < $1.path }
+            .map { try String(contentsOf: $0, encoding: .utf8) }
+    }
+
+    /// functions.rad has no preamble, so it stays valid when repeated.
+    private func largeScript() throws -> String {
+        let unit = try String(contentsOf: Self.repoRoot.appendingPathComponent("bench/corpus/functions.rad"), encoding: .utf8)
+        return String(repeating: unit, count: (256 * 1024) / unit.utf8.count + 1)
+    }
+
+    private func makeParser() throws -> Parser {
+        let parser = Parser()
+        try parser.setLanguage(Language(language: tree_sitter_rad()))
+        return parser
+    }
+
+    func testParsePerformance() throws {
+        let parser = try makeParser()
+        let source = try largeScript()
+        measure {
+            XCTAssertNotNil(parser.parse(source))
+        }
+    }
+
+    func testTraversalPerformance() throws {
+        let tree = try XCTUnwrap(try makeParser().parse(try largeScript()))
+        let root = try XCTUnwrap(tree.rootNode)
+        measure {
+            XCTAssertGreaterThan(RadBatchParser.countNodes(root), 0)
+        }
+    }
+
+    func testBatchParsePerformance() throws {
+        let sources = Array(repeating: try corpus(), count: 50).flatMap { $0 }
+        measure {
+            let done = expectation(description: "batch parsed")
+            Task {
+                defer { done.fulfill() }
+                do {
+                    let counts = try await RadBatchParser.nodeCounts(sources)
+                    XCTAssertEqual(counts.count, sources.count)
+                } catch {
+                    XCTFail("nodeCounts failed: \(error)")
+                }
+            }
+            wait(for: [done], timeout: 60)
+        }
+    }
+
+    func testBatchParseKeepsOrder() async throws {
+        let sources = try corpus()
+        let parser = try makeParser()
+        let expected = sources.map { source in
+            parser.parse(source)?.rootNode.map(RadBatchParser.countNodes)
+        }
+
+        let counts = try await RadBatchParser.nodeCounts(sources, maxConcurrency: 4)
+        XCTAssertEqual(counts, expected)
+    }
+}
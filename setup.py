@@ -1,5 +1,8 @@
-from os.path import isdir, join
+from os import environ
+from os.path import isdir, isfile, join
 from platform import system
+from subprocess import CalledProcessError, check_output
+from warnings import warn
 
 from setuptools import Extension, find_packages, setup
 from setuptools.command.build import build
@@ -14,6 +17,53 @@ class Build(build):
         super().run()
 
 
+def runtime_flags():
+    """Sources and flags for the tree-sitter C library, which parse_many() needs.
+
+    The library is compiled in from the checkout named by
+    TREE_SITTER_RUNTIME_DIR (release wheels do this), or linked as found by
+    pkg-config. Without either, or with TREE_SITTER_RAD_RUNTIME=0, the extension
+    is built without it and parse_many() raises RuntimeError.
+    """
+    if environ.get("TREE_SITTER_RAD_RUNTIME") == "0":
+        return [], [], [], [], []
+    macros = [("TREE_SITTER_RAD_RUNTIME", None)]
+    threads = ["-pthread"] if system() != "Windows" else []
+
+    runtime_dir = environ.get("TREE_SITTER_RUNTIME_DIR")
+    if runtime_dir:
+        lib = join(runtime_dir, "lib", "src", "lib.c")
+        if not isfile(lib):
+            raise SystemExit(f"TREE_SITTER_RUNTIME_DIR: {lib} does not exist")
+        if system() != "Windows":
+            macros.append(("_DEFAULT_SOURCE", None))
+        includes = [join(runtime_dir, "lib", "include"), join(runtime_dir, "lib", "src")]
+        return [lib], includes, threads, threads, macros
+
+    try:
+        cflags = check_output(["pkg-config", "--cflags", "tree-sitter"], text=True).split()
+        libs = check_output(["pkg-config", "--libs", "tree-sitter"], text=True).split()
+    except (OSError, CalledProcessError):
+        warn(
+            "tree-sitter-rad: the tree-sitter C library was not found, so parse_many()\n"
+            "and node_table() will raise RuntimeError. Set TREE_SITTER_RUNTIME_DIR to a\n"
+            "tree-sitter checkout to compile it in, or install it where pkg-config finds it."
+        )
+        return [], [], [], [], []
+    return [], [], cflags + threads, libs + threads, macros
+
+
+runtime_sources, runtime_includes, runtime_cflags, runtime_libs, runtime_macros = runtime_flags()
+
+# Match the C library's -O2 regardless of how Python itself was built, and
+# let release builds opt into link-time optimization across parser.c and
+# scanner.c with TREE_SITTER_RAD_LTO=1.
+if environ.get("TREE_SITTER_RAD_LTO") == "1":
+    lto_flags = (["-flto"], ["-flto"]) if system() != "Windows" else (["/GL"], ["/LTCG"])
+else:
+    lto_flags = ([], [])
+
+
 class BdistWheel(bdist_wheel):
     def get_tag(self):
         python, abi, platform = super().get_tag()
@@ -36,21 +86,24 @@ setup(
             sources=[
                 "bindings/python/tree_sitter_rad/binding.c",
                 "src/parser.c",
-                # NOTE: if your language uses an external scanner, add it here.
-            ],
-            extra_compile_args=[
+                "src/scanner.c",
+            ] + runtime_sources,
+            extra_compile_args=([
                 "-std=c11",
                 "-fvisibility=hidden",
+                "-O2",
             ] if system() != "Windows" else [
                 "/std:c11",
                 "/utf-8",
-            ],
-            define_macros=[
+                "/O2",
+            ]) + lto_flags[0] + runtime_cflags,
+            extra_link_args=lto_flags[1] + runtime_libs,
+            define_macros=runtime_macros + [
                 ("Py_LIMITED_API", "0x03090000"),
                 ("PY_SSIZE_T_CLEAN", None),
                 ("TREE_SITTER_HIDE_SYMBOLS", None),
             ],
-            include_dirs=["src"],
+            include_dirs=["src"] + runtime_includes,
             py_limited_api=True,
         )
     ],